@@ -19,6 +19,12 @@ Buffer base class used for serializing objects.
 #include "TClass.h"
 #include "TProcessID.h"
 
+#include <algorithm>
+
+#if defined(R__BYTESWAP) && defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
 constexpr Int_t kExtraSpace    = 8;   // extra space at end of buffer (used for free block count)
 constexpr Int_t kMaxBufferSize  = 0x7FFFFFFE;  // largest possible size.
 
@@ -385,39 +391,111 @@ TVirtualArray *TBuffer::PopDataCache()
    return val;
 }
 
+#ifdef R__BYTESWAP
+namespace {
+
+/// Reverse the bytes of each of the n elements of size kSize at buf.
+template <std::size_t kSize>
+void ByteSwapScalar(char *buf, Long64_t n)
+{
+   for (Long64_t idx = 0; idx < n; ++idx)
+      std::reverse(buf + idx * kSize, buf + (idx + 1) * kSize);
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+/// The shuffle mask reversing the bytes of each element of size kSize within a 16-byte lane.
+template <std::size_t kSize>
+__m128i ByteSwapMask()
+{
+   alignas(16) char mask[16];
+   for (std::size_t i = 0; i < 16; ++i)
+      mask[i] = (i / kSize) * kSize + kSize - 1 - i % kSize;
+   return _mm_load_si128(reinterpret_cast<const __m128i *>(mask));
+}
+
+template <std::size_t kSize>
+__attribute__((target("ssse3"))) void ByteSwapSSSE3(char *buf, Long64_t n)
+{
+   constexpr Long64_t kPerVector = 16 / kSize;
+   const __m128i mask = ByteSwapMask<kSize>();
+   Long64_t idx = 0;
+   for (; idx + kPerVector <= n; idx += kPerVector) {
+      auto ptr = reinterpret_cast<__m128i *>(buf + idx * kSize);
+      _mm_storeu_si128(ptr, _mm_shuffle_epi8(_mm_loadu_si128(ptr), mask));
+   }
+   ByteSwapScalar<kSize>(buf + idx * kSize, n - idx);
+}
+
+template <std::size_t kSize>
+__attribute__((target("avx2"))) void ByteSwapAVX2(char *buf, Long64_t n)
+{
+   constexpr Long64_t kPerVector = 32 / kSize;
+   // vpshufb shuffles within each 128-bit lane, so the same mask is used for both lanes
+   const __m256i mask = _mm256_broadcastsi128_si256(ByteSwapMask<kSize>());
+   Long64_t idx = 0;
+   for (; idx + kPerVector <= n; idx += kPerVector) {
+      auto ptr = reinterpret_cast<__m256i *>(buf + idx * kSize);
+      _mm256_storeu_si256(ptr, _mm256_shuffle_epi8(_mm256_loadu_si256(ptr), mask));
+   }
+   ByteSwapScalar<kSize>(buf + idx * kSize, n - idx);
+}
+
+enum class ESIMDLevel { kNone, kSSSE3, kAVX2 };
+
+ESIMDLevel GetSIMDLevel()
+{
+   static const ESIMDLevel level = [] {
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+         return ESIMDLevel::kAVX2;
+      if (__builtin_cpu_supports("ssse3"))
+         return ESIMDLevel::kSSSE3;
+      return ESIMDLevel::kNone;
+   }();
+   return level;
+}
+#endif
+
+/// Reverse the bytes of each of the n elements of size kSize at buf, using the widest vector instructions supported
+/// by the CPU.
+template <std::size_t kSize>
+void ByteSwap(char *buf, Long64_t n)
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+   switch (GetSIMDLevel()) {
+   case ESIMDLevel::kAVX2: ByteSwapAVX2<kSize>(buf, n); return;
+   case ESIMDLevel::kSSSE3: ByteSwapSSSE3<kSize>(buf, n); return;
+   case ESIMDLevel::kNone: break;
+   }
+#endif
+   ByteSwapScalar<kSize>(buf, n);
+}
+
+} // anonymous namespace
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Byte-swap N primitive-elements in the buffer.
 /// Bulk API relies on this function.
+///
+/// On x86-64, the byte swap uses SSSE3 or AVX2 instructions if the CPU supports them.
 
 Bool_t TBuffer::ByteSwapBuffer(Long64_t n, EDataType type)
 {
    char *input_buf = GetCurrent();
    if ((type == EDataType::kShort_t) || (type == EDataType::kUShort_t)) {
 #ifdef R__BYTESWAP
-      Short_t *buf __attribute__((aligned(8))) = reinterpret_cast<Short_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Short_t tmp = *reinterpret_cast<Short_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char *>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwap<sizeof(Short_t)>(input_buf, n);
 #endif
    } else if ((type == EDataType::kFloat_t) || (type == EDataType::kInt_t) || (type == EDataType::kUInt_t)) {
 #ifdef R__BYTESWAP
-      Float_t *buf __attribute__((aligned(8))) = reinterpret_cast<Float_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Float_t tmp = *reinterpret_cast<Float_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char *>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwap<sizeof(Int_t)>(input_buf, n);
 #endif
-   } else if ((type == EDataType::kDouble_t) || (type == EDataType::kLong64_t) || (type == EDataType::kULong64_t)) {
+   } else if ((type == EDataType::kDouble_t) || (type == EDataType::kLong64_t) || (type == EDataType::kULong64_t) ||
+              (sizeof(Long_t) == sizeof(Long64_t) && ((type == EDataType::kLong_t) || (type == EDataType::kULong_t)))) {
+      // Long_t values are always written as 8 bytes, they can be swapped in place only if they have that size in memory
 #ifdef R__BYTESWAP
-      Double_t *buf __attribute__((aligned(8))) = reinterpret_cast<Double_t*>(input_buf);
-      for (int idx=0; idx<n; idx++) {
-         Double_t tmp = *reinterpret_cast<Double_t*>(buf + idx); // Makes a copy of the values; frombuf can't handle aliasing.
-         char *tmp_ptr = reinterpret_cast<char*>(&tmp);
-         frombuf(tmp_ptr, buf + idx);
-      }
+      ByteSwap<sizeof(Long64_t)>(input_buf, n);
 #endif
    } else {
       return false;
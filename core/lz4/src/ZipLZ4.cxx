@@ -18,6 +18,7 @@
 #include <cstring>
 #include <lz4.h>
 #include <lz4hc.h>
+#include <memory>
 #include <xxhash.h>
 
 // Header consists of:
@@ -30,6 +31,33 @@ static const int kChecksumOffset = 2 + 1 + 3 + 3;
 static const int kChecksumSize = sizeof(XXH64_canonical_t);
 static const int kHeaderSize = kChecksumOffset + kChecksumSize;
 
+namespace {
+
+// LZ4_compress_HC allocates and frees its state (about 256 kB) at every call: each thread keeps one instead, reused
+// by all its calls. Thread-local objects are destroyed at thread exit, which for the main thread happens before the
+// atexit handlers that close the files still open; the calls made after that allocate a state of their own.
+struct RThreadHCState {
+   std::unique_ptr<char[]> fState{new char[LZ4_sizeofStateHC()]};
+   ~RThreadHCState() { fgDestroyed = true; }
+   // Trivially destructible, so it can still be read once RThreadHCState is gone
+   static thread_local bool fgDestroyed;
+};
+
+thread_local bool RThreadHCState::fgDestroyed = false;
+
+/// Return the LZ4HC state of the calling thread or, after its destruction, a new one owned by `ownState`
+void *GetHCState(std::unique_ptr<char[]> &ownState)
+{
+   if (RThreadHCState::fgDestroyed) {
+      ownState.reset(new char[LZ4_sizeofStateHC()]);
+      return ownState.get();
+   }
+   thread_local RThreadHCState state;
+   return state.fState.get();
+}
+
+} // anonymous namespace
+
 void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    int LZ4_version = LZ4_versionNumber();
@@ -52,7 +80,9 @@ void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, in
       cxlevel = 9;
    }
    if (cxlevel >= 4) {
-      returnStatus = LZ4_compress_HC(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
+      std::unique_ptr<char[]> ownState;
+      returnStatus = LZ4_compress_HC_extStateHC(GetHCState(ownState), src, &tgt[kHeaderSize], *srcsize,
+                                                *tgtsize - kHeaderSize, cxlevel);
    } else {
       returnStatus = LZ4_compress_default(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize);
    }
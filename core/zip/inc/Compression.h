@@ -39,6 +39,8 @@ namespace ROOT {
 ///   [207 - 208]
 ///  - LZ4 is recommended to be used with compression level 4 [404]
 ///  - ZSTD is recommended to be used with compression level 5 [505]
+///  - ZSTD with dictionaries [605] compresses the baskets of each TTree branch using a dictionary trained on its
+///    first baskets, and stored with the branch. It is most useful for branches with small baskets, of a few kB.
 
 struct RCompressionSetting {
    struct EDefaults { /// Note: this is only temporarily a struct and will become a enum class hence the name convention
@@ -96,6 +98,9 @@ struct RCompressionSetting {
          kLZ4,
          /// Use ZSTD compression
          kZSTD,
+         /// Use ZSTD compression with a dictionary per TTree branch, trained on its first baskets. Objects without
+         /// a dictionary, e.g. TKeys, use plain ZSTD compression.
+         kZSTDDictionary,
          /// Undefined compression algorithm (must be kept the last of the list in case a new algorithm is added).
          kUndefined
       };
@@ -33,6 +33,22 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * ZSTD dictionaries, see ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary. A dictionary must be registered
+ * to compress buffers with it and to decompress them: R__unzip finds the dictionary of a buffer by the dictionary ID
+ * stored in the compressed buffer.
+ */
+/// Train a dictionary on the concatenated samples; return its size, or 0 if the samples are not suitable.
+extern "C" int R__ZSTDTrainDictionary(char *dict, int dictCapacity, const char *samples, const int *sampleSizes,
+                                      int nSamples);
+/// Register a dictionary, return its ID or 0 in case of error. Registrations are reference counted.
+extern "C" unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictSize);
+/// Release a registration of a dictionary.
+extern "C" void R__ZSTDReleaseDictionary(unsigned int dictID);
+/// Compress with ZSTD using a registered dictionary; the output is decompressed by R__unzip.
+extern "C" void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                         unsigned int dictID);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
@@ -0,0 +1,159 @@
+#include "gtest/gtest.h"
+
+#include "Compression.h"
+#include "RZip.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ROOT::RCompressionSetting;
+
+namespace {
+
+/// Buffer contents similar to a basket of integers, compressible but not trivially so
+std::vector<char> MakeBuffer(int size, int seed)
+{
+   std::vector<char> buffer(size);
+   for (int i = 0; i < size; ++i)
+      buffer[i] = static_cast<char>((i / 4) % (17 + seed) + ((i * seed) % 7 == 0 ? i % 251 : 0));
+   return buffer;
+}
+
+/// Compress and uncompress the buffer, return an error message or an empty string
+std::string RoundTrip(const std::vector<char> &buffer, int level, RCompressionSetting::EAlgorithm::EValues algorithm)
+{
+   // 9 bytes of header, the LZ4 checksum, plus the usual margin for incompressible input
+   std::vector<char> zipped(buffer.size() + 9 + 8 + buffer.size() / 10);
+   int srcSize = buffer.size();
+   int tgtSize = zipped.size();
+   int zippedSize = 0;
+   R__zipMultipleAlgorithm(level, &srcSize, const_cast<char *>(buffer.data()), &tgtSize, zipped.data(), &zippedSize,
+                           algorithm);
+   if (zippedSize <= 0)
+      return "compression failed";
+
+   int headerSrcSize = 0;
+   int headerTgtSize = 0;
+   if (R__unzip_header(&headerSrcSize, reinterpret_cast<unsigned char *>(zipped.data()), &headerTgtSize) != 0)
+      return "wrong header";
+   if (headerSrcSize != zippedSize || headerTgtSize != srcSize)
+      return "wrong sizes in header";
+
+   std::vector<char> unzipped(buffer.size());
+   int unzippedSize = 0;
+   int unzipTgtSize = unzipped.size();
+   R__unzip(&zippedSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipTgtSize,
+            reinterpret_cast<unsigned char *>(unzipped.data()), &unzippedSize);
+   if (unzippedSize != srcSize)
+      return "decompression failed";
+   if (unzipped != buffer)
+      return "decompressed buffer differs";
+   return "";
+}
+
+} // anonymous namespace
+
+// The compression backends keep per-thread compression and decompression contexts: calls alternating algorithms,
+// levels and sizes, from several threads at the same time, must still round-trip.
+TEST(RZip, RoundTripConcurrent)
+{
+   const std::vector<RCompressionSetting::EAlgorithm::EValues> algorithms{
+      RCompressionSetting::EAlgorithm::kZLIB, RCompressionSetting::EAlgorithm::kLZMA,
+      RCompressionSetting::EAlgorithm::kLZ4, RCompressionSetting::EAlgorithm::kZSTD};
+   const std::vector<int> sizes{16 * 1024, 32 * 1024, 64 * 1024, 1000};
+   const std::vector<int> levels{1, 5, 9};
+
+   const unsigned int nThreads = 4;
+   std::vector<std::vector<std::string>> errors(nThreads);
+   auto work = [&](unsigned int thread) {
+      for (int rep = 0; rep < 3; ++rep) {
+         for (auto level : levels) {
+            for (auto size : sizes) {
+               const auto buffer = MakeBuffer(size, thread + rep);
+               for (auto algorithm : algorithms) {
+                  const auto error = RoundTrip(buffer, level, algorithm);
+                  if (!error.empty())
+                     errors[thread].push_back(error + " (algorithm " + std::to_string(algorithm) + ", level " +
+                                              std::to_string(level) + ", size " + std::to_string(size) + ")");
+               }
+            }
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (auto t = 0u; t < nThreads; ++t)
+      threads.emplace_back(work, t);
+   for (auto &t : threads)
+      t.join();
+
+   for (const auto &threadErrors : errors)
+      for (const auto &error : threadErrors)
+         ADD_FAILURE() << error;
+}
+
+// exit() destroys the per-thread states of the main thread before calling the atexit handlers, one of which closes
+// the files still open and thus compresses their last records: compressing from there must still work.
+TEST(RZip, RoundTripAtExit)
+{
+   auto compressAndExit = []() {
+      // create the per-thread states of this thread
+      RoundTrip(MakeBuffer(1000, 1), 5, RCompressionSetting::EAlgorithm::kZSTD);
+      RoundTrip(MakeBuffer(1000, 1), 5, RCompressionSetting::EAlgorithm::kLZ4);
+      std::atexit([]() {
+         const auto buffer = MakeBuffer(16 * 1024, 2);
+         const auto zstdError = RoundTrip(buffer, 5, RCompressionSetting::EAlgorithm::kZSTD);
+         const auto lz4Error = RoundTrip(buffer, 5, RCompressionSetting::EAlgorithm::kLZ4);
+         std::fprintf(stderr, "round trips at exit: %s, %s\n", zstdError.empty() ? "ok" : zstdError.c_str(),
+                      lz4Error.empty() ? "ok" : lz4Error.c_str());
+      });
+      std::exit(0);
+   };
+   EXPECT_EXIT(compressAndExit(), ::testing::ExitedWithCode(0), "round trips at exit: ok, ok");
+}
+
+TEST(RZip, ZSTDDictionary)
+{
+   // samples and buffer similar to the baskets of an integer branch
+   std::vector<char> samples;
+   std::vector<int> sampleSizes;
+   for (int i = 0; i < 16; ++i) {
+      const auto sample = MakeBuffer(2000, i);
+      samples.insert(samples.end(), sample.begin(), sample.end());
+      sampleSizes.push_back(sample.size());
+   }
+   std::vector<char> dict(3200);
+   const int dictSize = R__ZSTDTrainDictionary(dict.data(), dict.size(), samples.data(), sampleSizes.data(), 16);
+   ASSERT_GT(dictSize, 0);
+   const unsigned int dictID = R__ZSTDRegisterDictionary(dict.data(), dictSize);
+   ASSERT_NE(dictID, 0u);
+   // registering the same dictionary again returns the same ID
+   EXPECT_EQ(R__ZSTDRegisterDictionary(dict.data(), dictSize), dictID);
+
+   auto buffer = MakeBuffer(2000, 3);
+   std::vector<char> zipped(buffer.size() + 100);
+   int srcSize = buffer.size();
+   int tgtSize = zipped.size();
+   int zippedSize = 0;
+   R__zipZSTDWithDictionary(5, &srcSize, buffer.data(), &tgtSize, zipped.data(), &zippedSize, dictID);
+   ASSERT_GT(zippedSize, 0);
+
+   // R__unzip finds the dictionary through the ID stored in the buffer
+   std::vector<char> unzipped(buffer.size());
+   int unzippedSize = 0;
+   int unzipTgtSize = unzipped.size();
+   R__unzip(&zippedSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipTgtSize,
+            reinterpret_cast<unsigned char *>(unzipped.data()), &unzippedSize);
+   EXPECT_EQ(unzippedSize, srcSize);
+   EXPECT_EQ(unzipped, buffer);
+
+   // once all the registrations are released, the buffer cannot be decompressed anymore
+   R__ZSTDReleaseDictionary(dictID);
+   R__ZSTDReleaseDictionary(dictID);
+   R__unzip(&zippedSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipTgtSize,
+            reinterpret_cast<unsigned char *>(unzipped.data()), &unzippedSize);
+   EXPECT_EQ(unzippedSize, 0);
+}
@@ -17,6 +17,12 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                              unsigned int dictID);
+int R__ZSTDTrainDictionary(char *dict, int dictCapacity, const char *samples, const int *sampleSizes, int nSamples);
+unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictSize);
+void R__ZSTDReleaseDictionary(unsigned int dictID);
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,10 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <iostream>
 
@@ -22,17 +25,123 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+// Creating a context allocates and initializes several hundred kilobytes, more than compressing or decompressing a
+// typical basket costs: each thread keeps one compression and one decompression context, reused by all its calls.
+// Thread-local objects are destroyed at thread exit, which for the main thread happens before the atexit handlers
+// that close the files still open; the calls made after that use a context of their own.
+template <typename Ctx, Ctx *(*Create)(), size_t (*Free)(Ctx *)>
+class RContext {
+    struct RThreadContext {
+        Ctx *fCtx = Create();
+        ~RThreadContext()
+        {
+            Free(fCtx);
+            fgThreadContextDestroyed = true;
+        }
+    };
+    // Trivially destructible, so it can still be read once RThreadContext is gone
+    static thread_local bool fgThreadContextDestroyed;
+
+    Ctx *fOwnCtx = nullptr;
+    Ctx *fCtx = nullptr;
+
+public:
+    RContext()
+    {
+        if (fgThreadContextDestroyed) {
+            fOwnCtx = fCtx = Create();
+        } else {
+            thread_local RThreadContext threadContext;
+            fCtx = threadContext.fCtx;
+        }
+    }
+    RContext(const RContext &) = delete;
+    RContext &operator=(const RContext &) = delete;
+    ~RContext() { Free(fOwnCtx); }
+
+    Ctx *Get() const { return fCtx; }
+};
+
+template <typename Ctx, Ctx *(*Create)(), size_t (*Free)(Ctx *)>
+thread_local bool RContext<Ctx, Create, Free>::fgThreadContextDestroyed = false;
+
+using RCCtx = RContext<ZSTD_CCtx, ZSTD_createCCtx, ZSTD_freeCCtx>;
+using RDCtx = RContext<ZSTD_DCtx, ZSTD_createDCtx, ZSTD_freeDCtx>;
+
+/// A dictionary registered with R__ZSTDRegisterDictionary, with its digested forms
+struct RDictionary {
+    std::string fContent;
+    unsigned int fRefCount = 0;
+    ZSTD_DDict *fDDict = nullptr;
+    std::map<int, ZSTD_CDict *> fCDicts; ///< Digested for compression, by ZSTD compression level
+
+    ~RDictionary()
+    {
+        ZSTD_freeDDict(fDDict);
+        for (auto &levelAndCDict : fCDicts)
+            ZSTD_freeCDict(levelAndCDict.second);
+    }
+};
+
+/// The dictionaries known to the process, by dictionary ID. ZSTD frames compressed with a dictionary store its ID,
+/// which is how R__unzipZSTD finds the dictionary needed to decompress a buffer. The dictionaries are shared with
+/// the compression and decompression calls using them, so that releasing a dictionary concurrently does not free it
+/// under their feet.
+struct RDictionaryRegistry {
+    std::mutex fMutex;
+    std::map<unsigned int, std::shared_ptr<RDictionary>> fDictionaries;
+};
+
+/// Never destroyed: closing the files still open at exit can need it after the destruction of the static objects
+RDictionaryRegistry &GetDictionaryRegistry()
+{
+    static auto *registry = new RDictionaryRegistry;
+    return *registry;
+}
+
+/// The returned pointer keeps the dictionary alive, even if it is released in the meantime
+std::shared_ptr<const ZSTD_CDict> GetCDict(unsigned int dictID, int level)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    auto &registry = GetDictionaryRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto it = registry.fDictionaries.find(dictID);
+    if (it == registry.fDictionaries.end())
+        return nullptr;
+    auto &cdict = it->second->fCDicts[level];
+    if (!cdict)
+        cdict = ZSTD_createCDict(it->second->fContent.data(), it->second->fContent.size(), level);
+    return std::shared_ptr<const ZSTD_CDict>(it->second, cdict);
+}
+
+/// The returned pointer keeps the dictionary alive, even if it is released in the meantime
+std::shared_ptr<const ZSTD_DDict> GetDDict(unsigned int dictID)
+{
+    auto &registry = GetDictionaryRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto it = registry.fDictionaries.find(dictID);
+    if (it == registry.fDictionaries.end())
+        return nullptr;
+    return std::shared_ptr<const ZSTD_DDict>(it->second, it->second->fDDict);
+}
+
+} // anonymous namespace
 
+static void ZipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                        const ZSTD_CDict *cdict)
+{
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    // both calls reset all the parameters of the context, nothing leaks from the previous call
+    RCCtx cctx;
+    size_t retval = cdict ? ZSTD_compress_usingCDict(cctx.Get(),
+                                                     &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                                     src, static_cast<size_t>(*srcsize), cdict)
+                          : ZSTD_compressCCtx(cctx.Get(),
+                                              &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                              src, static_cast<size_t>(*srcsize),
+                                              2*cxlevel);
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,10 +167,70 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                              unsigned int dictID)
+{
+    const auto cdict = GetCDict(dictID, 2*cxlevel);
+    if (R__unlikely(!cdict)) {
+        std::cerr << "R__zipZSTDWithDictionary: dictionary " << dictID << " is not registered." << std::endl;
+        *irep = 0;
+        return;
+    }
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, cdict.get());
+}
+
+int R__ZSTDTrainDictionary(char *dict, int dictCapacity, const char *samples, const int *sampleSizes, int nSamples)
+{
+    std::unique_ptr<size_t[]> sizes{new size_t[nSamples]};
+    for (int i = 0; i < nSamples; ++i)
+        sizes[i] = static_cast<size_t>(sampleSizes[i]);
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictCapacity), samples, sizes.get(),
+                                          static_cast<unsigned>(nSamples));
+    // training fails if the samples are too few or too uniform for a dictionary to help, which is not an error
+    return ZDICT_isError(retval) ? 0 : static_cast<int>(retval);
+}
+
+unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictSize)
+{
+    // the ID of a trained dictionary is a hash of its content
+    const unsigned int dictID = ZDICT_getDictID(dict, static_cast<size_t>(dictSize));
+    if (R__unlikely(dictID == 0)) {
+        std::cerr << "R__ZSTDRegisterDictionary: not a ZSTD dictionary." << std::endl;
+        return 0;
+    }
+
+    auto &registry = GetDictionaryRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto &entry = registry.fDictionaries[dictID];
+    if (!entry) {
+        entry = std::make_shared<RDictionary>();
+        entry->fContent.assign(dict, static_cast<size_t>(dictSize));
+        entry->fDDict = ZSTD_createDDict(dict, static_cast<size_t>(dictSize));
+    } else if (R__unlikely(entry->fContent.compare(0, std::string::npos, dict, dictSize) != 0)) {
+        std::cerr << "R__ZSTDRegisterDictionary: a different dictionary with ID " << dictID
+                  << " is already registered." << std::endl;
+        return 0;
+    }
+    ++entry->fRefCount;
+    return dictID;
+}
+
+void R__ZSTDReleaseDictionary(unsigned int dictID)
+{
+    auto &registry = GetDictionaryRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto it = registry.fDictionaries.find(dictID);
+    if (it != registry.fDictionaries.end() && --it->second->fRefCount == 0)
+        registry.fDictionaries.erase(it);
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +246,27 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    // buffers compressed with a dictionary carry its ID
+    std::shared_ptr<const ZSTD_DDict> ddict;
+    const unsigned int dictID =
+        ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    if (dictID != 0) {
+        ddict = GetDDict(dictID);
+        if (R__unlikely(!ddict)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with dictionary " << dictID <<
+            ", which is not registered." << std::endl;
+            return;
+        }
+    }
+
+    RDCtx dctx;
+    size_t retval = ddict ? ZSTD_decompress_usingDDict(dctx.Get(),
+                                                       (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                       (char *)&src[kHeaderSize],
+                                                       static_cast<size_t>(*srcsize - kHeaderSize), ddict.get())
+                          : ZSTD_decompressDCtx(dctx.Get(),
+                                                (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -14,13 +14,25 @@
 
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
+#include <RConfigure.h> // R__HAS_URING
 
 #include <cstddef>
 #include <cstdint>
 
+#ifdef R__HAS_URING
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
+
 namespace ROOT {
 namespace Internal {
 
+#ifdef R__HAS_URING
+class RIoUring;
+#endif
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
@@ -31,6 +43,16 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+#ifdef R__HAS_URING
+   /// Vector reads are submitted in a batch through an io_uring.  Each vector read takes a ring from this list, or
+   /// sets up a new one if the list is empty, and gives it back once its reads completed: concurrent vector reads
+   /// use different rings, as a ring cannot tell whose completion events it returns.
+   std::vector<std::unique_ptr<RIoUring>> fIdleIoUrings;
+   /// Protects fIdleIoUrings; not held during the reads
+   std::mutex fIoUringLock;
+   /// Set if the io_uring setup or a batched read failed; vector reads then use blocking I/O
+   std::atomic<bool> fIsIoUringFailed{false};
+#endif
 
 protected:
    void OpenImpl() final;
@@ -42,6 +42,10 @@ ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions option
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+#ifdef R__HAS_URING
+   // Tear down the rings before closing the file descriptor their requests refer to
+   fIdleIoUrings.clear();
+#endif
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -52,6 +56,10 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   if (!fIsIoUringFailed)
+      return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#endif
    return kFeatureHasSize | kFeatureHasMmap;
 }
 
@@ -115,10 +123,18 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   if (!fIsIoUringFailed) {
+      std::unique_ptr<RIoUring> ioUring;
+      {
+         std::lock_guard<std::mutex> lockGuard(fIoUringLock);
+         if (!fIdleIoUrings.empty()) {
+            ioUring = std::move(fIdleIoUrings.back());
+            fIdleIoUrings.pop_back();
+         }
+      }
       try {
-         RIoUring ring; // throws std::runtime_error
+         if (!ioUring)
+            ioUring = std::make_unique<RIoUring>(); // throws std::runtime_error
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,17 +145,22 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         ioUring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
+         std::lock_guard<std::mutex> lockGuard(fIoUringLock);
+         fIdleIoUrings.emplace_back(std::move(ioUring));
          return;
       }
       catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
+         // Only warn once, even if several concurrent vector reads fail
+         if (!fIsIoUringFailed.exchange(true)) {
+            Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
+            Warning("RRawFileUnix",
+                 "io_uring setup failed, falling back to blocking I/O in ReadV");
+         }
+         // A failed ring might have unreaped completion events; it is not given back
       }
    }
 #endif
@@ -374,16 +374,32 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge the RNTuple named ntupleName from all the source files that contain it, starting with firstSource.
+/// The RNTuple class lives in a library that RIO does not depend on, so the merging is dispatched through
+/// the merge function of the RNTuple anchor's dictionary.  Its input list consists of an object carrying the
+/// ntuple name followed by the source files.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *anchor, const char *ntupleName, const TString &path,
+                       TList &sources, TFile *firstSource, TFileMergeInfo &info)
+{
+   if (!rntupleHandle || !rntupleHandle->GetMerge()) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+
+   TList inputs;
+   TObjString name(ntupleName);
+   inputs.Add(&name);
+   TFile *nextsource = firstSource ? firstSource : (TFile *)sources.First();
+   while (nextsource) {
+      TDirectory *ndir = nextsource->GetDirectory(path);
+      if (ndir && ndir->GetListOfKeys()->FindObject(ntupleName))
+         inputs.Add(nextsource);
+      nextsource = (TFile *)sources.After(nextsource);
+   }
+
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   auto result = func(anchor, &inputs, &info);
+   inputs.Clear("nodelete");
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -596,13 +612,20 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         if (type & kIncremental) {
+            Error("MergeRecursive", "incremental merging of RNTuples is not supported (key: %s)", keyname);
+            return kFALSE;
+         }
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, path, *sourcelist, current_file, info);
+         if (ownobj)
+            cl->Destructor(obj);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merged RNTuple writes its own anchor to the target, the anchor read from the first source is stale
+         oldkeyname = keyname;
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
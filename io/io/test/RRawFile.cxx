@@ -1,5 +1,8 @@
 #include "io_test.hxx"
 
+#include <thread>
+#include <vector>
+
 namespace {
 
 /**
@@ -138,6 +141,44 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVConcurrent)
+{
+   std::string content;
+   for (int i = 0; i < 4096; ++i)
+      content.push_back(static_cast<char>('a' + i % 26));
+   FileRaii readvGuard("test_rawfile_readv_concurrent", content);
+   // With io_uring, the threads share the ring of the raw file
+   auto f = RRawFile::Create("test_rawfile_readv_concurrent");
+   f->GetSize();
+
+   std::vector<std::thread> threads;
+   std::vector<int> nErrors(4, 0);
+   for (unsigned t = 0; t < nErrors.size(); ++t) {
+      threads.emplace_back([&f, &content, &nErrors, t]() {
+         for (unsigned i = 0; i < 200; ++i) {
+            char buffer[2 * 16];
+            RRawFile::RIOVec iovec[2];
+            for (unsigned j = 0; j < 2; ++j) {
+               iovec[j].fBuffer = &buffer[16 * j];
+               iovec[j].fOffset = (t * 997 + i * 31 + j * 2048) % (content.size() - 16);
+               iovec[j].fSize = 16;
+            }
+            f->ReadV(iovec, 2);
+            for (unsigned j = 0; j < 2; ++j) {
+               if ((iovec[j].fOutBytes != 16) ||
+                   (content.compare(iovec[j].fOffset, 16, &buffer[16 * j], 16) != 0))
+                  nErrors[t]++;
+            }
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (auto n : nErrors)
+      EXPECT_EQ(0, n);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
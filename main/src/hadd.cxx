@@ -80,6 +80,11 @@
   (i.e. direct copy of the raw byte on disk). The "fast" mode is typically
   5 times faster than the mode unzipping and unstreaming the baskets.
 
+  RNTuples (experimental) found in the top-level directory of the sources are concatenated as well.
+  Their pages are copied without decompression if the target compression setting matches the one
+  of the source. Otherwise the pages are recompressed with the target compression setting.
+  Incremental merging (-a) of RNTuples is not supported.
+
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
 
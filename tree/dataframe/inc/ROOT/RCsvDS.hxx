@@ -41,19 +41,37 @@ private:
    // Regular expressions for type inference
    static const TRegexp fgIntRegex, fgDoubleRegex1, fgDoubleRegex2, fgDoubleRegex3, fgTrueRegex, fgFalseRegex;
 
+   /// The lines of the current batch that make up one entry range, as byte offsets in fBatch
+   struct RChunk {
+      ULong64_t fFirstEntry;
+      ULong64_t fEndEntry;
+      std::size_t fBegin;
+      std::size_t fEnd;
+   };
+
+   /// The parsing position of a slot in the current batch
+   struct RSlotCursor {
+      std::size_t fChunk = std::size_t(-1); ///< Index in fChunks, or -1 if the slot has not started yet
+      std::size_t fPos = 0;                 ///< Offset in fBatch of the line of entry fNextEntry
+      ULong64_t fNextEntry = 0;
+      std::string fScratch; ///< Holds fields that must be unquoted before being converted to numbers
+   };
+
    std::uint64_t fDataPos = 0;
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
-   ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
+   std::uint64_t fReadPos = 0;       // offset in the file of the first line not yet read
    std::vector<std::string> fHeaders;
    std::map<std::string, ColType_t> fColTypes;
    std::list<ColType_t> fColTypesList;
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot]
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column]
+   std::vector<char> fBatch;                               // the lines read by the last GetEntryRanges call
+   std::vector<RChunk> fChunks;                            // one per entry range of the last GetEntryRanges call
+   std::vector<RSlotCursor> fSlotCursors;                  // one per slot, indexed by slot * CacheLineStep
    std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
    std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
    std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
@@ -62,7 +80,9 @@ private:
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   ULong64_t ReadBatch();
+   void MoveCursor(RSlotCursor &, ULong64_t);
+   void ParseLine(unsigned int, const char *, const char *, ULong64_t);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
    void InferColTypes(std::vector<std::string> &);
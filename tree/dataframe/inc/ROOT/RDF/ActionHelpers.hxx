@@ -44,13 +44,23 @@
 #include "TTree.h"
 #include "TTreeReader.h" // for SnapshotHelper
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/RField.hxx" // for SnapshotRNTupleHelper
+#include "ROOT/RNTupleModel.hxx"
+#endif
 
 #include <algorithm>
+#include <array>
+#include <cstddef> // std::size_t
+#include <functional>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 #include <iomanip>
 #include <numeric> // std::accumulate in MeanHelper
@@ -58,6 +68,17 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+
+#ifdef R__HAS_ROOT7
+namespace Experimental {
+class REntry;
+class RNTupleWriter;
+namespace Detail {
+class RPageSink;
+}
+} // namespace Experimental
+#endif
+
 namespace Detail {
 namespace RDF {
 template <typename Helper>
@@ -79,8 +100,37 @@ public:
    {
       throw std::logic_error("`GetMergeableValue` is not implemented for this type of action.");
    }
+
+   // The type of the mergeable returned by GetMergeableValue, nullptr if it is not implemented
+   virtual const std::type_info *GetMergeableValueType() const { return nullptr; }
+
+   // Overwrite the result with the value of a mergeable returned by GetMergeableValue for the same kind of action,
+   // e.g. after merging the partial results of several worker processes
+   virtual void SetFromMergeableValue(const RMergeableValueBase &)
+   {
+      throw std::logic_error("`SetFromMergeableValue` is not implemented for this type of action.");
+   }
 };
 
+// Copy the value of a mergeable into the result of an action, if the type of the result supports it
+template <typename T>
+void AssignMergedValue(T &result, const RMergeableValueBase &value, std::true_type /*isCopyAssignable*/)
+{
+   result = static_cast<const RMergeableValue<T> &>(value).GetValue();
+}
+
+template <typename T>
+void AssignMergedValue(T &, const RMergeableValueBase &, std::false_type /*isCopyAssignable*/)
+{
+   throw std::logic_error("The result of this action cannot be assigned a merged value.");
+}
+
+template <typename T>
+void AssignMergedValue(T &result, const RMergeableValueBase &value)
+{
+   AssignMergedValue(result, value, std::is_copy_assignable<T>{});
+}
+
 } // namespace RDF
 } // namespace Detail
 
@@ -147,9 +197,20 @@ public:
       return std::make_unique<RMergeableCount>(*fResultCount);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableCount); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultCount, value); }
+
    ULong64_t &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Count"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<ULong64_t> *`. See RVariedAction.
+   CountHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ULong64_t> *>(newResult);
+      return CountHelper(result, fCounts.size());
+   }
 };
 
 template <typename ProxiedVal_t>
@@ -270,7 +331,18 @@ public:
       return std::make_unique<RMergeableFill<Hist_t>>(*fResultHist);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableFill<Hist_t>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultHist, value); }
+
    std::string GetActionName() { return "Fill"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<Hist_t> *`. See RVariedAction.
+   FillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<Hist_t> *>(newResult);
+      return FillHelper(result, fNSlots);
+   }
 };
 
 extern template void FillHelper::Exec(unsigned int, const std::vector<float> &);
@@ -285,36 +357,118 @@ extern template void FillHelper::Exec(unsigned int, const std::vector<int> &, co
 extern template void
 FillHelper::Exec(unsigned int, const std::vector<unsigned int> &, const std::vector<unsigned int> &);
 
+/// Fill `h` with the `n` values `xs`, weighted by `ws` if not null, like calling `h.Fill(xs[i], ws[i])` for each value.
+/// Histograms with fixed binning, no buffer and no axis extension are filled without calling TH1::Fill: the bin
+/// index is computed inline and the statistics are updated once for the whole batch.
+void FillTH1DBulk(::TH1D &h, std::size_t n, const double *xs, const double *ws);
+
+/// Merge the objects with indices 1 to n-1 into object 0, as a binary tree of pairwise merges: `mergeInto(i, j)` must
+/// merge object `j` into object `i`. If implicit multi-threading is enabled, the merges of each level of the tree run
+/// in parallel.
+void TreeReduce(std::size_t n, const std::function<void(std::size_t, std::size_t)> &mergeInto);
+
+/// The per-slot buffer of the values filled into a TH1D by FillParHelper, see FillTH1DBulk
+struct RFillBuffer {
+   static constexpr std::size_t kSize = 1024; ///< Number of values buffered before filling the histogram
+   std::vector<double> fXs;
+   std::vector<double> fWs; ///< Empty for unweighted fills
+};
+
 template <typename HIST = Hist_t>
 class FillParHelper : public RActionImpl<FillParHelper<HIST>> {
+   /// TH1D is filled in batches from per-slot buffers, other types are filled one value at a time
+   using IsBuffered_t = std::is_same<HIST, ::TH1D>;
+
    std::vector<HIST *> fObjects;
+   /// Empty copy of the result, from which the objects of the other slots are created. Null if there is one slot.
+   std::unique_ptr<HIST> fModel;
+   /// Per-slot fill buffers, indexed by slot * CacheLineStep. Empty if HIST is not TH1D.
+   std::vector<RFillBuffer> fBuffers;
+
+   RFillBuffer &GetBuffer(unsigned int slot) { return fBuffers[slot * CacheLineStep<RFillBuffer>()]; }
+
+   void FlushBuffer(unsigned int slot, std::true_type)
+   {
+      auto &buffer = GetBuffer(slot);
+      if (buffer.fXs.empty())
+         return;
+      FillTH1DBulk(*fObjects[slot], buffer.fXs.size(), buffer.fXs.data(),
+                   buffer.fWs.empty() ? nullptr : buffer.fWs.data());
+      buffer.fXs.clear();
+      buffer.fWs.clear();
+   }
+
+   void FlushBuffer(unsigned int, std::false_type) {}
+
+   void FillOne(unsigned int slot, double x0, std::true_type)
+   {
+      auto &buffer = GetBuffer(slot);
+      buffer.fXs.emplace_back(x0);
+      if (buffer.fXs.size() == RFillBuffer::kSize)
+         FlushBuffer(slot, std::true_type{});
+   }
+
+   template <typename X0>
+   void FillOne(unsigned int slot, const X0 &x0, std::false_type)
+   {
+      fObjects[slot]->Fill(x0);
+   }
+
+   // for TH1D, the second value is the weight
+   void FillOne(unsigned int slot, double x0, double w, std::true_type)
+   {
+      auto &buffer = GetBuffer(slot);
+      buffer.fXs.emplace_back(x0);
+      buffer.fWs.emplace_back(w);
+      if (buffer.fXs.size() == RFillBuffer::kSize)
+         FlushBuffer(slot, std::true_type{});
+   }
+
+   template <typename X0, typename X1>
+   void FillOne(unsigned int slot, const X0 &x0, const X1 &x1, std::false_type)
+   {
+      fObjects[slot]->Fill(x0, x1);
+   }
+
+   static HIST *MakeCopy(const HIST &obj)
+   {
+      auto copy = new HIST(obj);
+      if (auto objAsHist = dynamic_cast<TH1 *>(copy)) {
+         objAsHist->SetDirectory(nullptr);
+      }
+      return copy;
+   }
 
 public:
    FillParHelper(FillParHelper &&) = default;
    FillParHelper(const FillParHelper &) = delete;
 
-   FillParHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillParHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fBuffers(IsBuffered_t::value ? nSlots * CacheLineStep<RFillBuffer>() : 0u)
    {
       fObjects[0] = h.get();
-      // Initialise all other slots
-      for (unsigned int i = 1; i < nSlots; ++i) {
-         fObjects[i] = new HIST(*fObjects[0]);
-         if (auto objAsHist = dynamic_cast<TH1*>(fObjects[i])) {
-            objAsHist->SetDirectory(nullptr);
-         }
-      }
+      if (nSlots > 1)
+         fModel.reset(MakeCopy(*fObjects[0]));
    }
 
-   void InitTask(TTreeReader *, unsigned int) {}
+   /// The objects of the slots other than 0 are created by the first task that runs in the slot, in the thread that
+   /// fills them: with first-touch memory allocation, their memory is local to the NUMA domain of that thread.
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fObjects[slot])
+         fObjects[slot] = MakeCopy(*fModel);
+   }
+
+   void FinalizeTask(unsigned int slot) { FlushBuffer(slot, IsBuffered_t{}); }
 
    void Exec(unsigned int slot, double x0) // 1D histos
    {
-      fObjects[slot]->Fill(x0);
+      FillOne(slot, x0, IsBuffered_t{});
    }
 
    void Exec(unsigned int slot, double x0, double x1) // 1D weighted and 2D histos
    {
-      fObjects[slot]->Fill(x0, x1);
+      FillOne(slot, x0, x1, IsBuffered_t{});
    }
 
    void Exec(unsigned int slot, double x0, double x1, double x2) // 2D weighted and 3D histos
@@ -330,9 +484,8 @@ public:
    template <typename X0, typename std::enable_if<IsDataContainer<X0>::value || std::is_same<X0, std::string>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s)
    {
-      auto thisSlotH = fObjects[slot];
       for (auto x0 = x0s.begin(); x0 != x0s.end(); x0++) {
-         thisSlotH->Fill(*x0); // TODO: Can be optimised in case T == vector<double>
+         FillOne(slot, *x0, IsBuffered_t{});
       }
    }
 
@@ -349,7 +502,6 @@ public:
              typename std::enable_if<IsDataContainer<X0>::value && IsDataContainer<X1>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const X1 &x1s)
    {
-      auto thisSlotH = fObjects[slot];
       if (x0s.size() != x1s.size()) {
          throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
       }
@@ -357,7 +509,7 @@ public:
       const auto x0sEnd = std::end(x0s);
       auto x1sIt = std::begin(x1s);
       for (; x0sIt != x0sEnd; x0sIt++, x1sIt++) {
-         thisSlotH->Fill(*x0sIt, *x1sIt); // TODO: Can be optimised in case T == vector<double>
+         FillOne(slot, *x0sIt, *x1sIt, IsBuffered_t{});
       }
    }
 
@@ -365,9 +517,8 @@ public:
              typename std::enable_if<IsDataContainer<X0>::value && !IsDataContainer<W>::value, int>::type = 0>
    void Exec(unsigned int slot, const X0 &x0s, const W w)
    {
-      auto thisSlotH = fObjects[slot];
       for (auto &&x : x0s) {
-         thisSlotH->Fill(x, w);
+         FillOne(slot, x, w, IsBuffered_t{});
       }
    }
 
@@ -449,18 +600,31 @@ public:
 
    void Finalize()
    {
-      auto resObj = fObjects[0];
-      const auto nSlots = fObjects.size();
-      TList l;
-      l.SetOwner(); // The list will free the memory associated to its elements upon destruction
-      for (unsigned int slot = 1; slot < nSlots; ++slot) {
-         l.Add(fObjects[slot]);
+      std::vector<HIST *> objects;
+      for (auto slot = 0u; slot < fObjects.size(); ++slot) {
+         if (fObjects[slot]) {
+            FlushBuffer(slot, IsBuffered_t{});
+            objects.emplace_back(fObjects[slot]);
+         }
       }
 
-      resObj->Merge(&l);
+      // merge pairs of per-slot objects rather than all of them into the result, so that merges can run in parallel
+      TreeReduce(objects.size(), [&objects](std::size_t i, std::size_t j) {
+         TList l;
+         l.Add(objects[j]);
+         objects[i]->Merge(&l);
+      });
+      for (auto slot = 1u; slot < fObjects.size(); ++slot) {
+         delete fObjects[slot];
+         fObjects[slot] = nullptr;
+      }
    }
 
-   HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      FlushBuffer(slot, IsBuffered_t{});
+      return *fObjects[slot];
+   }
 
    // Helper functions for RMergeableValue
    std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
@@ -468,7 +632,18 @@ public:
       return std::make_unique<RMergeableFill<HIST>>(*fObjects[0]);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableFill<HIST>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fObjects[0], value); }
+
    std::string GetActionName() { return "FillPar"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<HIST> *`. See RVariedAction.
+   FillParHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      return FillParHelper(result, fObjects.size());
+   }
 };
 
 class FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
@@ -537,6 +712,10 @@ public:
       return std::make_unique<RMergeableFill<Result_t>>(*fGraphs[0]);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableFill<Result_t>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fGraphs[0], value); }
+
    std::string GetActionName() { return "Graph"; }
 
    Result_t &PartialUpdate(unsigned int slot) { return *fGraphs[slot]; }
@@ -792,9 +971,20 @@ public:
       return std::make_unique<RMergeableMin<ResultType>>(*fResultMin);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableMin<ResultType>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultMin, value); }
+
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
    std::string GetActionName() { return "Min"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<ResultType> *`. See RVariedAction.
+   MinHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MinHelper(result, fMins.size());
+   }
 };
 
 // TODO
@@ -843,9 +1033,20 @@ public:
       return std::make_unique<RMergeableMax<ResultType>>(*fResultMax);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableMax<ResultType>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultMax, value); }
+
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
    std::string GetActionName() { return "Max"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<ResultType> *`. See RVariedAction.
+   MaxHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return MaxHelper(result, fMaxs.size());
+   }
 };
 
 // TODO
@@ -907,9 +1108,20 @@ public:
       return std::make_unique<RMergeableSum<ResultType>>(*fResultSum);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableSum<ResultType>); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultSum, value); }
+
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
    std::string GetActionName() { return "Sum"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<ResultType> *`. See RVariedAction.
+   SumHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<ResultType> *>(newResult);
+      return SumHelper(result, fSums.size());
+   }
 };
 
 class MeanHelper : public RActionImpl<MeanHelper> {
@@ -945,9 +1157,20 @@ public:
       return std::make_unique<RMergeableMean>(*fResultMean, counts);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableMean); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultMean, value); }
+
    double &PartialUpdate(unsigned int slot);
 
    std::string GetActionName() { return "Mean"; }
+
+   /// Return a helper that writes its result to `newResult`, a `std::shared_ptr<double> *`. See RVariedAction.
+   MeanHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<double> *>(newResult);
+      return MeanHelper(result, fSums.size());
+   }
 };
 
 extern template void MeanHelper::Exec(unsigned int, const std::vector<float> &);
@@ -995,6 +1218,10 @@ public:
       return std::make_unique<RMergeableStdDev>(*fResultStdDev, counts, mean);
    }
 
+   const std::type_info *GetMergeableValueType() const final { return &typeid(RMergeableStdDev); }
+
+   void SetFromMergeableValue(const RMergeableValueBase &value) final { AssignMergedValue(*fResultStdDev, value); }
+
    std::string GetActionName() { return "StdDev"; }
 };
 
@@ -1354,6 +1581,92 @@ public:
    std::string GetActionName() { return "Snapshot"; }
 };
 
+#ifdef R__HAS_ROOT7
+/// Type-independent part of the RNTuple Snapshot action.  It owns one RNTupleWriter per slot.  In single-thread
+/// runs, the only writer writes directly to the output file.  In multi-thread runs, every slot writes its own
+/// temporary file; at the end of the event loop, the temporary files are merged into the output file by copying
+/// their sealed pages and then removed.
+class SnapshotRNTupleWriters {
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const RSnapshotOptions fOptions;
+   /// Only set if the output file is opened in "UPDATE" mode
+   std::unique_ptr<TFile> fOutputFile;
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleModel>> fModels;
+   /// The top-level fields of the models, in the order of the Snapshot columns
+   std::vector<std::vector<ROOT::Experimental::Detail::RFieldBase *>> fFields;
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleWriter>> fWriters;
+   /// Entries that capture the column values of the last event; recreated when the value addresses change
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   std::vector<std::vector<void *>> fEntryAddresses;
+
+   std::string GetSlotFileName(unsigned int slot) const;
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> MakeOutputSink();
+
+public:
+   SnapshotRNTupleWriters(unsigned int nSlots, const std::string &fileName, const std::string &dirName,
+                          const std::string &ntupleName, const RSnapshotOptions &options);
+   SnapshotRNTupleWriters(const SnapshotRNTupleWriters &) = delete;
+   SnapshotRNTupleWriters &operator=(const SnapshotRNTupleWriters &) = delete;
+   ~SnapshotRNTupleWriters();
+
+   /// Takes the model built from the column types; every slot writes with its own clone
+   void Initialize(std::unique_ptr<ROOT::Experimental::RNTupleModel> model);
+   /// Creates the writer of the slot the first time the slot is used
+   void InitSlot(unsigned int slot);
+   /// Writes one entry whose values are found at the given addresses
+   void Fill(unsigned int slot, void *const *addresses);
+   void Finalize();
+};
+
+/// Helper object for a Snapshot action that writes an RNTuple, both single-thread and multi-thread
+template <typename... ColTypes>
+class SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   // must be a ptr because helpers must be movable
+   std::unique_ptr<SnapshotRNTupleWriters> fWriters;
+   const ColumnNames_t fOutputFieldNames;
+
+   template <typename T>
+   static void AddField(ROOT::Experimental::RNTupleModel &model, const std::string &fieldName)
+   {
+      model.AddField(std::make_unique<ROOT::Experimental::RField<T>>(fieldName));
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fWriters(std::make_unique<SnapshotRNTupleWriters>(nSlots, std::string(filename), std::string(dirname),
+                                                          std::string(ntuplename), options)),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames))
+   {
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriters->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      const std::array<void *, sizeof...(ColTypes)> addresses{{&values...}};
+      fWriters->Fill(slot, addresses.data());
+   }
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      std::size_t i = 0;
+      int expander[] = {(AddField<ColTypes>(*model, fOutputFieldNames[i++]), 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+      fWriters->Initialize(std::move(model));
+   }
+
+   void Finalize() { fWriters->Finalize(); }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+#endif // R__HAS_ROOT7
+
 /// Helper object for a multi-thread Snapshot action
 template <typename... ColTypes>
 class SnapshotHelperMT : public RActionImpl<SnapshotHelperMT<ColTypes...>> {
@@ -14,6 +14,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "TString.h"
 
 #include <iostream>
@@ -52,6 +53,9 @@ private:
    bool fIsNew = true; ///< A just created node. This means that in no other exploration the node was already created
    ///< (this is needed because branches may share some common node).
 
+   ULong64_t fNCalls = 0; ///< Number of evaluations recorded by the profiler, see RInterface::SetProfiling
+   double fTime = 0.;     ///< Exclusive time recorded by the profiler, in seconds
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Returns a static variable to allow each node to retrieve its counter
    static unsigned int &GetStaticGlobalCounter()
@@ -97,6 +101,24 @@ public:
 
    bool GetIsNew() { return fIsNew; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Annotates the node with the counters of the profiler, if it recorded any evaluation
+   void SetProfile(const RNodeProfile &profile)
+   {
+      const auto total = profile.GetTotal();
+      fNCalls = total.fNCalls;
+      fTime = total.fTime;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the label of the node in the dot representation
+   std::string GetLabel() const
+   {
+      if (fNCalls == 0)
+         return fName;
+      return fName + "\n" + std::to_string(fNCalls) + " calls, " + Form("%.3g", fTime) + " s";
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Gives a different shape based on the node type
    void SetRoot()
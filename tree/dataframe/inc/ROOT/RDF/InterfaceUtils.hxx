@@ -25,14 +25,17 @@
 #include <ROOT/RMakeUnique.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
+#include <RConfigure.h> // R__HAS_ROOT7
 #include <TError.h> // gErrorIgnoreLevel
 #include <TH1.h>
 #include <TROOT.h> // IsImplicitMTEnabled
 
+#include <array>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
@@ -42,6 +45,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -237,6 +241,57 @@ struct SnapshotHelperArgs {
    ROOT::RDF::RSnapshotOptions fOptions;
 };
 
+#ifdef R__HAS_ROOT7
+/// Create the data frame returned by an RNTuple Snapshot.  The ntuple is only opened once the data frame is used,
+/// i.e. after the snapshot has written it.
+std::shared_ptr<ROOT::RDataFrame> MakeLazyNTupleDataFrame(std::string_view ntupleName, std::string_view fileName);
+
+/// Whether Snapshot can write columns of type T to RNTuple. Classes are written through their dictionary, other types
+/// need a specialization of RField: the generic RField fails to compile for them.
+template <typename T>
+struct RIsRNTupleWritable
+   : std::integral_constant<bool, std::is_class<T>::value ||
+                                     !std::is_base_of<ROOT::Experimental::RClassField,
+                                                      ROOT::Experimental::RField<T>>::value> {
+};
+
+template <typename T>
+struct RIsRNTupleWritable<std::vector<T>> : RIsRNTupleWritable<T> {
+};
+
+template <typename T>
+struct RIsRNTupleWritable<ROOT::VecOps::RVec<T>> : RIsRNTupleWritable<T> {
+};
+
+template <typename T, std::size_t N>
+struct RIsRNTupleWritable<std::array<T, N>> : RIsRNTupleWritable<T> {
+};
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildRNTupleSnapshotAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperArgs> &snapHelperArgs,
+                           const unsigned int nSlots, std::shared_ptr<PrevNodeType> prevNode,
+                           const RBookedDefines &defines, std::true_type /*areWritable*/)
+{
+   // single-thread and multi-thread snapshot to RNTuple
+   using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+   using Action_t = RAction<Helper_t, PrevNodeType>;
+   const auto &args = *snapHelperArgs;
+   return std::unique_ptr<RActionBase>(
+      new Action_t(Helper_t(nSlots, args.fFileName, args.fDirName, args.fTreeName, args.fOutputColNames,
+                            args.fOptions),
+                   colNames, prevNode, defines));
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildRNTupleSnapshotAction(const ColumnNames_t &, const std::shared_ptr<SnapshotHelperArgs> &, const unsigned int,
+                           std::shared_ptr<PrevNodeType>, const RBookedDefines &, std::false_type /*areWritable*/)
+{
+   throw std::runtime_error("Snapshot: the type of some of the columns cannot be written to RNTuple");
+}
+#endif
+
 // Snapshot action
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -251,7 +306,15 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &options = snapHelperArgs->fOptions;
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      actionPtr = BuildRNTupleSnapshotAction<ColTypes...>(
+         colNames, snapHelperArgs, nSlots, std::move(prevNode), defines,
+         std::integral_constant<bool, RAllOf_t<RIsRNTupleWritable<ColTypes>::value...>::value>{});
+#else
+      throw std::runtime_error("Snapshot: RNTuple output is only available if ROOT is built with root7");
+#endif
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -299,6 +362,20 @@ void CheckForDefinition(const std::string &where, std::string_view definedColVie
 
 std::string PrettyPrintAddr(const void *const addr);
 
+/// Name of the TTree in the files of the persistent cache of Cache(), see RInterface::SetCacheDirectory
+constexpr auto kPersistentCacheTreeName = "rdfcache";
+
+std::string GetPersistentCachePath(RLoopManager &lm, RNodeBase &node, const ColumnNames_t &columns,
+                                   const RBookedDefines &defines);
+
+bool HasPersistentCacheFile(const std::string &path);
+
+std::string MakePersistentCacheTmpPath(const RLoopManager &lm, const std::string &path);
+
+void CommitPersistentCacheFile(const std::string &tmpPath, const std::string &path);
+
+void RemovePersistentCacheTmpFile(const std::string &tmpPath);
+
 void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter, std::shared_ptr<RNodeBase> *prevNodeOnHeap,
                    std::string_view name, std::string_view expression,
                    const std::map<std::string, std::string> &aliasMap, const ColumnNames_t &branches,
@@ -455,7 +532,8 @@ void JitDefineHelper(F &&f, const char **colsPtr, std::size_t colsSize, std::str
    const auto dummyType = "jittedCol_t";
    // use unique_ptr<RDefineBase> instead of make_unique<NewCol_t> to reduce jit/compile-times
    jittedDefine->SetDefine(std::unique_ptr<RDefineBase>(
-      new NewCol_t(name, dummyType, std::forward<F>(f), cols, lm->GetNSlots(), *defines, lm->GetDSValuePtrs(), ds)));
+      new NewCol_t(name, dummyType, std::forward<F>(f), cols, lm->GetNSlots(), *defines, lm->GetDSValuePtrs(),
+                   lm->GetProfilingFlag(), ds)));
 
    // defines points to the columns structure in the heap, created before the jitted call so that the jitter can
    // share data after it has lazily compiled the code. Here the data has been used and the memory can be freed.
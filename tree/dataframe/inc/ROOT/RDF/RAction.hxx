@@ -17,11 +17,16 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/RVariedAction.hxx"
 
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility> // std::declval, std::index_sequence
 #include <vector>
 
 namespace ROOT {
@@ -87,12 +92,21 @@ public:
       return fHelper.GetMergeableValue();
    }
 
+   const std::type_info *GetMergeableValueType() const final { return fHelper.GetMergeableValueType(); }
+
+   void SetFromMergeableValue(const RDFDetail::RMergeableValueBase &value) final
+   {
+      fHelper.SetFromMergeableValue(value);
+   }
+
    void Initialize() final { fHelper.Initialize(); }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       for (auto &bookedBranch : GetDefines().GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
                                            fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
@@ -109,8 +123,10 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RProfileScope profileScope(fLoopManager->IsProfiling(), fProfile, slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
@@ -120,6 +136,8 @@ public:
    {
       for (auto &column : GetDefines().GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->FinaliseSlot(slot);
       for (auto &v : fValues[slot])
          v.reset();
       fHelper.CallFinalizeTask(slot);
@@ -133,6 +151,8 @@ public:
       SetHasRun();
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       auto prevNode = fPrevData.GetGraph();
@@ -145,6 +165,7 @@ public:
 
       thisNode->AddDefinedColumns(GetDefines().GetNames());
       thisNode->SetAction(HasRun());
+      thisNode->SetProfile(GetProfile());
       upmostNode->SetPrevNode(prevNode);
       return thisNode;
    }
@@ -153,6 +174,18 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   RVariationKeys GetVariationKeys() final
+   {
+      auto keys = fPrevData.GetVariationKeys();
+      keys.Merge(GetColumnVariationKeys(GetColumnNames(), GetDefines()));
+      return keys;
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
+   {
+      return MakeVariedActionImpl(std::move(results), 0);
+   }
+
 private:
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
@@ -164,6 +197,33 @@ private:
 
    // this one is always available but has lower precedence thanks to `...`
    void *PartialUpdateImpl(...) { throw std::runtime_error("This action does not support callbacks!"); }
+
+   // this overload is SFINAE'd out if Helper does not implement `MakeNew`
+   template <typename H = Helper>
+   auto MakeVariedActionImpl(std::vector<void *> &&results, int)
+      -> decltype(std::declval<H &>().MakeNew((void *)(nullptr)), std::unique_ptr<RActionBase>())
+   {
+      std::vector<unsigned int> keys;
+      for (auto variation : GetVariationKeys().GetVariations()) {
+         for (auto i = 0u; i < variation->GetTags().size(); ++i)
+            keys.emplace_back(variation->GetFirstKey() + i);
+      }
+      if (keys.size() != results.size())
+         throw std::logic_error("The number of varied results does not match the number of variations.");
+
+      std::vector<Helper> helpers;
+      helpers.reserve(results.size());
+      for (auto result : results)
+         helpers.emplace_back(fHelper.MakeNew(result));
+
+      return std::unique_ptr<RActionBase>(new RVariedAction<Helper, PrevDataFrame, ColumnTypes_t>(
+         std::move(helpers), keys, GetColumnNames(), fPrevDataPtr, GetDefines()));
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedActionImpl(std::vector<void *> &&, long)
+   {
+      throw std::logic_error("This action does not support systematic variations.");
+   }
 };
 
 } // namespace RDF
@@ -12,11 +12,15 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
 #include <memory>
 #include <string>
+#include <typeinfo>
+#include <vector>
 
 namespace ROOT {
 
@@ -49,6 +53,9 @@ private:
 
    RBookedDefines fDefines;
 
+protected:
+   RNodeProfile fProfile; ///< Profiling counters of the executions of the action
+
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines);
    RActionBase(const RActionBase &) = delete;
@@ -80,6 +87,25 @@ public:
       with others of the same type.
    */
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
+   /// The type of the mergeable returned by GetMergeableValue, or nullptr if the result of the action cannot be merged.
+   /// Unlike GetMergeableValue, it does not copy the result.
+   virtual const std::type_info *GetMergeableValueType() const = 0;
+   /// Overwrite the result of the action with the value of a mergeable returned by GetMergeableValue for the same
+   /// action, e.g. in another process.
+   virtual void SetFromMergeableValue(const RMergeableValueBase &value) = 0;
+
+   /// Return the systematic variations that affect the inputs of this action. Only valid after jitting.
+   virtual RVariationKeys GetVariationKeys() = 0;
+
+   /// Create the action that computes the results of this action for each key of the systematic variations returned
+   /// by GetVariationKeys, in the same order. `results` holds, for each key, the address of a `std::shared_ptr` to
+   /// the (not yet filled) varied result. See ROOT::RDF::Experimental::VariationsFor.
+   virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
+
+   /// Return the name of the action, as used in the representation of the computation graph
+   virtual std::string GetActionName() = 0;
+   /// Return the profiling counters of this action, see RLoopManager::SetProfiling. Overridden by RJittedAction.
+   virtual const RNodeProfile &GetProfile() const { return fProfile; }
 };
 } // namespace RDF
 } // namespace Internal
@@ -30,6 +30,8 @@ namespace RDF {
 
 namespace RDFDetail = ROOT::Detail::RDF;
 
+class RVariationBase;
+
 /**
  * \class ROOT::Internal::RDF::RBookedDefines
  * \ingroup dataframe
@@ -43,10 +45,13 @@ class RBookedDefines {
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
+   using RVariationBasePtrMap_t = std::map<std::string, std::shared_ptr<RVariationBase>>;
+   using RVariationBasePtrMapPtr_t = std::shared_ptr<const RVariationBasePtrMap_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;  // also abused to keep track of aliases for each branch of the computation graph
+   RVariationBasePtrMapPtr_t fVariations; ///< Systematic variations, keyed by the name of the varied column
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -64,7 +69,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
    RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames)
-      : fDefines(defines), fDefinesNames(defineNames)
+      : fDefines(defines), fDefinesNames(defineNames), fVariations(std::make_shared<RVariationBasePtrMap_t>())
    {
    }
 
@@ -72,7 +77,8 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedDefines()
       : fDefines(std::make_shared<RDefineBasePtrMap_t>()),
-        fDefinesNames(std::make_shared<ColumnNames_t>())
+        fDefinesNames(std::make_shared<ColumnNames_t>()),
+        fVariations(std::make_shared<RVariationBasePtrMap_t>())
    {
    }
 
@@ -84,6 +90,10 @@ public:
    /// \brief Returns the list of the pointers to the defined columns
    const RDefineBasePtrMap_t &GetColumns() const { return *fDefines; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the systematic variations, keyed by the name of the varied column
+   const RVariationBasePtrMap_t &GetVariations() const { return *fVariations; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Check if the provided name is tracked in the names list
    bool HasName(std::string_view name) const;
@@ -91,6 +101,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Add a new booked column.
    /// Internally it recreates the map with the new column, and swaps it with the old one.
+   /// A variation of a previous column with the same name (i.e. in case of a Redefine) does not apply to the new one.
    void AddColumn(const std::shared_ptr<RDFDetail::RDefineBase> &column, std::string_view name);
 
    ////////////////////////////////////////////////////////////////////////////
@@ -100,6 +111,11 @@ public:
    /// in each branch of the computation graph.
    /// Internally it recreates the vector with the new name, and swaps it with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Add a systematic variation of the column returned by RVariationBase::GetColumnName.
+   /// Internally it recreates the map with the new variation, and swaps it with the old one.
+   void AddVariation(const std::shared_ptr<RVariationBase> &variation);
 };
 
 } // Namespace RDF
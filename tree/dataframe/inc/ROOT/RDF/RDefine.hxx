@@ -69,6 +69,10 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// The systematic variations that affect the input columns, resolved by GetVariationKeys.
+   RDFInternal::RVariationKeys fVariationKeys;
+   bool fHasVariationKeys = false;
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
@@ -103,8 +107,9 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
            unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
-           const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
-      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds), fExpression(std::move(expression)),
+           const std::map<std::string, std::vector<void *>> &DSValuePtrs, const bool &isProfiling,
+           ROOT::RDF::RDataSource *ds)
+      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, isProfiling, ds), fExpression(std::move(expression)),
         fColumnNames(columns), fLastResults(fNSlots * RDFInternal::CacheLineStep<ret_type>()), fValues(fNSlots),
         fIsDefine()
    {
@@ -135,11 +140,24 @@ public:
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, Long64_t entry) final
    {
-      if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+      const auto variation = fVariationKeys.GetActiveKey();
+      if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] ||
+          variation != fLastCheckedVariation[slot * RDFInternal::CacheLineStep<unsigned int>()]) {
+         RDFInternal::RProfileScope profileScope(fIsProfiling, fProfile, slot);
          // evaluate this filter, cache the result
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
+         fLastCheckedVariation[slot * RDFInternal::CacheLineStep<unsigned int>()] = variation;
+      }
+   }
+
+   const RDFInternal::RVariationKeys &GetVariationKeys() final
+   {
+      if (!fHasVariationKeys) {
+         fVariationKeys = RDFInternal::GetColumnVariationKeys(fColumnNames, fDefines);
+         fHasVariationKeys = true;
       }
+      return fVariationKeys;
    }
 
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
@@ -13,6 +13,8 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 
 #include <deque>
 #include <map>
@@ -39,20 +41,25 @@ protected:
    unsigned int fNStopsReceived{0}; ///< number of times that a children node signaled to stop processing entries.
    const unsigned int fNSlots;      ///< number of thread slots used by this node, inherited from parent node.
    std::vector<Long64_t> fLastCheckedEntry;
+   /// The variation key the value of fLastCheckedEntry was computed for, see RVariationKeys
+   std::vector<unsigned int> fLastCheckedVariation;
    /// A unique ID that identifies this custom column.
    /// Used e.g. to distinguish custom columns with the same name in different branches of the computation graph.
    const unsigned int fID = GetNextID();
    RDFInternal::RBookedDefines fDefines;
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
    const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   const bool &fIsProfiling;                                        // reference to RLoopManager's data member
    ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+   RDFInternal::RNodeProfile fProfile;  ///< Profiling counters of the evaluations of the expression
 
    static unsigned int GetNextID();
 
 public:
    RDefineBase(std::string_view name, std::string_view type, unsigned int nSlots,
                const RDFInternal::RBookedDefines &defines,
-               const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+               const std::map<std::string, std::vector<void *>> &DSValuePtrs, const bool &isProfiling,
+               ROOT::RDF::RDataSource *ds);
 
    RDefineBase &operator=(const RDefineBase &) = delete;
    RDefineBase &operator=(RDefineBase &&) = delete;
@@ -69,6 +76,10 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Return the systematic variations that affect the defined value. Only valid after jitting.
+   virtual const RDFInternal::RVariationKeys &GetVariationKeys() = 0;
+   /// Return the profiling counters of this define, see RLoopManager::SetProfiling. Overridden by RJittedDefine.
+   virtual const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
 };
 
 } // ns RDF
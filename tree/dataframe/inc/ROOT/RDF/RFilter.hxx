@@ -17,6 +17,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
@@ -62,6 +63,22 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+   /// The systematic variations that affect this filter or the upstream ones, resolved by GetVariationKeys.
+   RDFInternal::RVariationKeys fVariationKeys;
+   bool fHasVariationKeys = false;
+
+   /// Evaluate the filter for the given variation key, see RVariedAction. Does not contribute to the report.
+   bool CheckVariedFilters(unsigned int slot, Long64_t entry, unsigned int variation)
+   {
+      if (entry != fLastCheckedVariedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] ||
+          variation != fLastCheckedVariation[slot * RDFInternal::CacheLineStep<unsigned int>()]) {
+         fLastVariedResult[slot * RDFInternal::CacheLineStep<int>()] =
+            fPrevData.CheckFilters(slot, entry) && CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedVariedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
+         fLastCheckedVariation[slot * RDFInternal::CacheLineStep<unsigned int>()] = variation;
+      }
+      return fLastVariedResult[slot * RDFInternal::CacheLineStep<int>()];
+   }
 
 public:
    RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd,
@@ -83,6 +100,10 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      const auto variation = fVariationKeys.GetActiveKey();
+      if (variation != 0)
+         return CheckVariedFilters(slot, entry, variation);
+
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevData.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
@@ -102,6 +123,7 @@ public:
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RDFInternal::RProfileScope profileScope(fLoopManager->IsProfiling(), fProfile, slot);
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
@@ -112,6 +134,8 @@ public:
    {
       for (auto &bookedBranch : fDefines.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : fDefines.GetVariations())
+         variation.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
                                            fLoopManager->GetDataSource()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
@@ -154,16 +178,34 @@ public:
       filters.push_back(name);
    }
 
+   void AddCacheKeys(std::vector<std::string> &keys) final
+   {
+      fPrevData.AddCacheKeys(keys);
+      keys.push_back("filter: " + (HasName() ? fName : "Unnamed Filter"));
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) final
    {
       for (auto &column : fDefines.GetColumns())
          column.second->FinaliseSlot(slot);
+      for (auto &variation : fDefines.GetVariations())
+         variation.second->FinaliseSlot(slot);
 
       for (auto &v : fValues[slot])
          v.reset();
    }
 
+   const RDFInternal::RVariationKeys &GetVariationKeys() final
+   {
+      if (!fHasVariationKeys) {
+         fVariationKeys = fPrevData.GetVariationKeys();
+         fVariationKeys.Merge(RDFInternal::GetColumnVariationKeys(fColumnNames, fDefines));
+         fHasVariationKeys = true;
+      }
+      return fVariationKeys;
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // Recursively call for the previous node.
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RBookedDefines.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
@@ -39,10 +40,16 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Memoization of the result for a systematic variation, separate from the nominal one so that evaluating a
+   /// variation never causes a re-evaluation (and a double counting in the report) of the nominal result.
+   std::vector<Long64_t> fLastCheckedVariedEntry;
+   std::vector<unsigned int> fLastCheckedVariation;
+   std::vector<int> fLastVariedResult;
    const std::string fName;
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedDefines fDefines;
+   RDFInternal::RNodeProfile fProfile; ///< Profiling counters of the evaluations of the filter expression
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -67,6 +74,10 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Return the defines available to this filter. Overridden by RJittedFilter.
+   virtual const RDFInternal::RBookedDefines &GetDefines() const { return fDefines; }
+   /// Return the profiling counters of this filter, see RLoopManager::SetProfiling. Overridden by RJittedFilter.
+   virtual const RDFInternal::RNodeProfile &GetProfile() const { return fProfile; }
 };
 
 } // ns RDF
@@ -16,7 +16,9 @@
 #include "ROOT/RDF/RBookedDefines.hxx"
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
@@ -476,6 +478,88 @@ public:
       return newInterface;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column.
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression A callable that evaluates the varied values for each entry. It must return an RVec with
+   ///            one element per variation tag, of the same type as the varied column.
+   /// \param[in] inputColumns The names of the columns to be passed to the callable.
+   /// \param[in] variationTags The names of the varied values, e.g. {"down", "up"}.
+   /// \param[in] variationName A generic name for this set of varied values, e.g. "ptvariation". If empty, the name of
+   ///            the varied column is used.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// The nominal value of the column is not affected: actions booked downstream of this node compute the same
+   /// results as before. The results corresponding to each varied value are only produced for the actions passed to
+   /// ROOT::RDF::Experimental::VariationsFor(), in the same event loop as the nominal results. Filters and Defines
+   /// downstream are re-evaluated for each varied value they depend on.
+   ///
+   /// A column can be varied only once along a branch of the computation graph, and variation names must be unique.
+   /// Redefining a varied column drops its variations. Actions downstream of a Range cannot be varied.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto nominal = df.Vary("pt", [](double pt) { return RVec<double>{pt * 0.9, pt * 1.1}; }, {"pt"},
+   ///                        {"down", "up"})
+   ///                   .Filter([](double pt) { return pt > 10; }, {"pt"})
+   ///                   .Histo1D<double>("pt");
+   /// auto hists = ROOT::RDF::Experimental::VariationsFor(nominal);
+   /// hists["nominal"]->Draw();
+   /// hists["pt:up"]->Draw("SAME");
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+      using RetType_t = typename TTraits::CallableTraits<F>::ret_type;
+      using Value_t = typename RetType_t::value_type;
+
+      constexpr auto where = "Vary";
+      const auto variedColumn = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      const std::string varName = variationName.empty() ? variedColumn : std::string(variationName);
+      if (variationTags.empty())
+         throw std::runtime_error(std::string(where) + ": no variation tags were passed for column \"" +
+                                  variedColumn + "\".");
+      const auto &variations = fDefines.GetVariations();
+      if (variations.find(variedColumn) != variations.end())
+         throw std::runtime_error(std::string(where) + ": column \"" + variedColumn + "\" is already varied.");
+      for (const auto &variation : variations) {
+         if (variation.second->GetVariationName() == varName)
+            throw std::runtime_error(std::string(where) + ": a variation named \"" + varName + "\" already exists.");
+      }
+
+      constexpr auto nColumns = ColTypes_t::list_size;
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      using NewVariation_t = RDFInternal::RVariation<F>;
+      auto newVariation = std::make_shared<NewVariation_t>(
+         variedColumn, varName, variationTags, RDFInternal::TypeID2TypeName(typeid(Value_t)), std::move(expression),
+         validColumnNames, fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(), fDataSource);
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(newVariation);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column, with tags "0", "1", ..., "nVariations-1".
+   /// See the corresponding Vary() overload for more information.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::move(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Allow to refer to a column with a different name.
    /// \param[in] alias name of the column alias
@@ -563,6 +647,16 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// If ROOT is built with root7, the columns can be written as an RNTuple instead of a TTree. In multi-thread runs,
+   /// every slot writes a temporary file next to the output file; the temporary files are merged into the output file
+   /// at the end of the event loop. Dots in column names are replaced by underscores in the field names as well. The
+   /// returned data frame reads the ntuple; it can be used only after the event loop ran:
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("outputNTuple", "outputFile.root", {"x", "y"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -594,12 +688,10 @@ public:
       treename = parsedTreePath.fTreeName;
       const auto &dirname = parsedTreePath.fDirName;
 
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, validCols, options);
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnList, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
-
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          validCols, newRDF, snapHelperArgs, validCols.size());
 
@@ -713,6 +805,15 @@ public:
          return emptyRDF;
       }
 
+      const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
+      // check the persistent cache before jitting anything
+      const auto cachePath =
+         RDFInternal::GetPersistentCachePath(*fLoopManager, *fProxiedPtr, validColumnNames, fDefines);
+      if (!cachePath.empty() && RDFInternal::HasPersistentCacheFile(cachePath)) {
+         fLoopManager->IncrNCacheCalls();
+         return MakePersistentCacheDF(cachePath, validColumnNames);
+      }
+
       std::stringstream cacheCall;
       auto upcastNode = RDFInternal::UpcastNode(fProxiedPtr);
       RInterface<TTraits::TakeFirstParameter_t<decltype(upcastNode)>> upcastInterface(fProxiedPtr, *fLoopManager,
@@ -725,7 +826,6 @@ public:
                 << ") = reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RNodeBase>*>("
                 << RDFInternal::PrettyPrintAddr(&upcastInterface) << ")->Cache<";
 
-      const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
       const auto colTypes = GetValidatedArgTypes(validColumnNames, fDefines, fLoopManager->GetTree(), fDataSource,
                                                  "Cache", /*vector2rvec=*/false);
       for (const auto &colType : colTypes)
@@ -2172,6 +2272,86 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Enables or disables the on-disk persistent cache of Cache().
+   /// \param[in] directory The local directory where cached datasets are stored, an empty string disables the cache
+   /// \param[in] version A user-defined string that is part of the cache keys, see below
+   ///
+   /// When the persistent cache is enabled, Cache() writes the selected columns to a ROOT file in `directory`, and
+   /// returns a RDataFrame that reads them from there. Later calls to Cache(), e.g. in a new run of the same
+   /// application, that are equivalent to a previous one find the file and use it directly: neither the input dataset
+   /// is read nor the upstream computation graph is just-in-time compiled and run.
+   ///
+   /// The file name is a hash of the input dataset (tree and file names, sizes and modification times, or number of
+   /// entries of an empty source), of the cached columns, of the names of the defined columns, filters and ranges
+   /// upstream of the Cache() call, of the expressions of the upstream jitted Filters and Defines and of the ordinal
+   /// number of the Cache() call for this dataframe. Changes to compiled callables passed to Filter and Define cannot
+   /// be detected: change `version` or clear the directory when they change. Datasets read from an RDataSource or from
+   /// a TTree that is not stored in a file are never cached on disk. The cached columns must be writable by Snapshot().
+   /// If writing a cache entry fails, no partial entry is left in the directory.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("Events", "sample.root");
+   /// df.SetCacheDirectory("/tmp/rdfcache");
+   /// auto cached = df.Filter("nMuon > 1").Define("pt0", "Muon_pt[0]").Cache({"pt0"}); // only slow the first time
+   /// ~~~
+   void SetCacheDirectory(std::string_view directory, std::string_view version = "")
+   {
+      fLoopManager->SetCacheDirectory(std::string(directory), std::string(version));
+   }
+
+   /// \brief Enables or disables the profiling of the event loops.
+   /// \param[in] enable Whether the next event loops record profiling information
+   ///
+   /// While profiling is enabled, the event loops record, per processing slot, the number of evaluations and the
+   /// exclusive wall time of every Filter, Define and action, the number of entries and the wall time of the tasks,
+   /// and the bytes read from ROOT files and the time spent reading and decompressing TTree baskets. The information
+   /// accumulates over event loops and can be retrieved with GetProfileReport(). Profiling has a small per-entry
+   /// overhead (two clock reads per evaluated node): only enable it to investigate performance.
+   /// The setting applies to the whole computation graph.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("Events", "sample.root");
+   /// df.SetProfiling(true);
+   /// auto h = df.Define("pt2", "pt * pt").Filter("pt2 > 100").Histo1D("pt2");
+   /// h->Draw();
+   /// df.GetProfileReport().Print();
+   /// ROOT::RDF::SaveGraph(df, "profile.dot"); // the graph nodes are annotated with number of calls and times
+   /// ~~~
+   void SetProfiling(bool enable) { fLoopManager->SetProfiling(enable); }
+
+   /// \brief Return the profiling information recorded so far, see SetProfiling().
+   ///
+   /// This method does not trigger the event loop. The report covers all Filters, Defines and actions of the
+   /// computation graph, including nodes that did not run while profiling was enabled, and can be printed or exported
+   /// as JSON. The counters of the nodes are also shown in the graph produced by ROOT::RDF::SaveGraph.
+   ROOT::RDF::RProfileReport GetProfileReport() { return fLoopManager->GetProfileReport(); }
+
+   /// \brief Run the next event loops in several local worker processes.
+   /// \param[in] nProcesses The number of worker processes. 0 and 1 run the event loops in this process.
+   ///
+   /// The worker processes are forked from this one when the event loop starts. Each worker runs the event loop in
+   /// sequence over its share of the entries (or of the entry ranges of the data source) and sends back the results
+   /// of the booked actions, which are merged in this process. As the workers do not share memory, the functions
+   /// passed to Define and Filter do not need to be thread-safe, and a crash in user code only brings down the event
+   /// loop, not the session.
+   ///
+   /// Only actions whose results can be merged are supported: Count, Sum, Mean, StdDev, Min, Max, Stats, Graph and
+   /// the histogram and profile actions. Booking other actions, e.g. Snapshot, Take or Foreach, or a Range makes the
+   /// event loop throw before it starts. Callbacks registered with OnPartialResult run in the worker processes, and
+   /// the profiling information of the workers is not collected. Multi-process event loops are not available on
+   /// Windows. The setting applies to the whole computation graph.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("Events", "sample.root");
+   /// df.SetNProcesses(8);
+   /// auto h = df.Filter("pt > 10").Histo1D("pt");
+   /// h->Draw(); // runs the event loop in 8 worker processes
+   /// ~~~
+   void SetNProcesses(unsigned int nProcesses) { fLoopManager->SetNProcesses(nProcesses); }
+
    /// \brief Get descriptive information about the dataset.
    /// \return Info describing the dataset as a multi-line string
    ///
@@ -2497,9 +2677,9 @@ private:
       auto entryColGen = [](unsigned int, ULong64_t entry) { return entry; };
       using NewColEntry_t = RDFDetail::RDefine<decltype(entryColGen), RDFDetail::CustomColExtraArgs::SlotAndEntry>;
 
-      auto entryColumn = std::make_shared<NewColEntry_t>(entryColName, entryColType, std::move(entryColGen),
-                                                         ColumnNames_t{}, fLoopManager->GetNSlots(), newCols,
-                                                         fLoopManager->GetDSValuePtrs(), fDataSource);
+      auto entryColumn = std::make_shared<NewColEntry_t>(
+         entryColName, entryColType, std::move(entryColGen), ColumnNames_t{}, fLoopManager->GetNSlots(), newCols,
+         fLoopManager->GetDSValuePtrs(), fLoopManager->GetProfilingFlag(), fDataSource);
       newCols.AddColumn(entryColumn, entryColName);
 
       // Slot number column
@@ -2508,9 +2688,9 @@ private:
       auto slotColGen = [](unsigned int slot) { return slot; };
       using NewColSlot_t = RDFDetail::RDefine<decltype(slotColGen), RDFDetail::CustomColExtraArgs::Slot>;
 
-      auto slotColumn = std::make_shared<NewColSlot_t>(slotColName, slotColType, std::move(slotColGen), ColumnNames_t{},
-                                                       fLoopManager->GetNSlots(), newCols,
-                                                       fLoopManager->GetDSValuePtrs(), fDataSource);
+      auto slotColumn = std::make_shared<NewColSlot_t>(
+         slotColName, slotColType, std::move(slotColGen), ColumnNames_t{}, fLoopManager->GetNSlots(), newCols,
+         fLoopManager->GetDSValuePtrs(), fLoopManager->GetProfilingFlag(), fDataSource);
       newCols.AddColumn(slotColumn, slotColName);
 
       fDefines = std::move(newCols);
@@ -2635,7 +2815,8 @@ private:
       using NewCol_t = RDFDetail::RDefine<F, DefineType>;
       auto newColumn =
          std::make_shared<NewCol_t>(name, retTypeName, std::forward<F>(expression), validColumnNames,
-                                    fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(), fDataSource);
+                                    fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(),
+                                    fLoopManager->GetProfilingFlag(), fDataSource);
 
       RDFInternal::RBookedDefines newCols(fDefines);
       newCols.AddColumn(newColumn, name);
@@ -2659,6 +2840,34 @@ private:
       return *this; // never reached
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the data frame returned by Snapshot.
+   /// Both a TTree and an RNTuple output are only opened once the returned data frame is used.
+   static std::shared_ptr<ROOT::RDataFrame>
+   MakeSnapshotOutputDF(std::string_view fullTreeName, std::string_view filename, const ColumnNames_t &validCols,
+                        const RSnapshotOptions &options)
+   {
+#ifdef R__HAS_ROOT7
+      if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return RDFInternal::MakeLazyNTupleDataFrame(fullTreeName, filename);
+#else
+      (void)options;
+#endif
+      ::TDirectory::TContext ctxt;
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the data frame returned by Cache() for a file of the persistent cache.
+   static RInterface<RLoopManager> MakePersistentCacheDF(const std::string &path, const ColumnNames_t &columns)
+   {
+      auto lm = std::make_shared<RLoopManager>(nullptr, columns);
+      auto chain = std::make_shared<TChain>(RDFInternal::kPersistentCacheTreeName);
+      chain->Add(path.c_str());
+      lm->SetTree(chain);
+      return RInterface<RLoopManager>(lm);
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2672,12 +2881,10 @@ private:
       const auto &treename = parsedTreePath.fTreeName;
       const auto &dirname = parsedTreePath.fDirName;
 
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, validCols, options);
       auto snapHelperArgs = std::make_shared<RDFInternal::SnapshotHelperArgs>(RDFInternal::SnapshotHelperArgs{
          std::string(filename), std::string(dirname), std::string(treename), columnList, options});
 
-      ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
-
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
       if (!options.fLazy)
@@ -2697,6 +2904,25 @@ private:
 
       RDFInternal::CheckTypesAndPars(sizeof...(ColTypes), columnList.size());
 
+      const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
+      const auto cachePath =
+         RDFInternal::GetPersistentCachePath(*fLoopManager, *fProxiedPtr, validColumnNames, fDefines);
+      if (!cachePath.empty()) {
+         if (!RDFInternal::HasPersistentCacheFile(cachePath)) {
+            const auto tmpPath = RDFInternal::MakePersistentCacheTmpPath(*fLoopManager, cachePath);
+            try {
+               Snapshot<ColTypes...>(RDFInternal::kPersistentCacheTreeName, tmpPath, validColumnNames);
+            } catch (...) {
+               RDFInternal::RemovePersistentCacheTmpFile(tmpPath);
+               throw;
+            }
+            RDFInternal::CommitPersistentCacheFile(tmpPath, cachePath);
+         }
+         fLoopManager->IncrNCacheCalls();
+         return MakePersistentCacheDF(cachePath, validColumnNames);
+      }
+      fLoopManager->IncrNCacheCalls();
+
       auto colHolders = std::make_tuple(Take<ColTypes>(columnList[S])...);
       auto ds = std::make_unique<RLazyDS<ColTypes...>>(std::make_pair(columnList[S], std::get<S>(colHolders))...);
 
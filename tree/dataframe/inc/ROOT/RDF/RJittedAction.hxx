@@ -60,6 +60,13 @@ public:
 
    // Helper for RMergeableValue
    std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> GetMergeableValue() const final;
+   const std::type_info *GetMergeableValueType() const final;
+   void SetFromMergeableValue(const ROOT::Detail::RDF::RMergeableValueBase &value) final;
+
+   RVariationKeys GetVariationKeys() final;
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final;
+   std::string GetActionName() final;
+   const RNodeProfile &GetProfile() const final;
 };
 
 } // ns RDF
@@ -16,6 +16,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
 #include <type_traits>
 
 class TTreeReader;
@@ -30,21 +31,28 @@ namespace RDF {
 /// before the event-loop starts.
 class RJittedDefine : public RDefineBase {
    std::unique_ptr<RDefineBase> fConcreteDefine = nullptr;
+   /// The expression of the defined column, as passed by the user
+   std::string fExpression;
 
 public:
    RJittedDefine(std::string_view name, std::string_view type, unsigned int nSlots,
-                       const std::map<std::string, std::vector<void *>> &DSValuePtrs)
-      : RDefineBase(name, type, nSlots, RDFInternal::RBookedDefines(), DSValuePtrs, nullptr)
+                 const std::map<std::string, std::vector<void *>> &DSValuePtrs, const bool &isProfiling,
+                 std::string_view expression = "")
+      : RDefineBase(name, type, nSlots, RDFInternal::RBookedDefines(), DSValuePtrs, isProfiling, nullptr),
+        fExpression(expression)
    {
    }
 
    void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   const std::string &GetExpression() const { return fExpression; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void FinaliseSlot(unsigned int slot) final;
+   const RDFInternal::RVariationKeys &GetVariationKeys() final;
+   const RDFInternal::RNodeProfile &GetProfile() const final;
 };
 
 } // ns RDF
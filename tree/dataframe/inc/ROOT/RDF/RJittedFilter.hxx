@@ -38,12 +38,21 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   /// The node upstream of this filter, known before the concrete filter is created
+   std::weak_ptr<RNodeBase> fPrevNode;
+   /// The filter expression, as passed by the user
+   std::string fExpression;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name);
    ~RJittedFilter() { fLoopManager->Deregister(this); }
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   void SetExpression(const std::shared_ptr<RNodeBase> &prevNode, std::string_view expression)
+   {
+      fPrevNode = prevNode;
+      fExpression = std::string(expression);
+   }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
@@ -57,8 +66,12 @@ public:
    void ResetReportCount() final;
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
+   void AddCacheKeys(std::vector<std::string> &keys) final;
    void FinaliseSlot(unsigned int slot) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
+   const ROOT::Internal::RDF::RVariationKeys &GetVariationKeys() final;
+   const RDFInternal::RBookedDefines &GetDefines() const final;
+   const RDFInternal::RNodeProfile &GetProfile() const final;
 };
 
 } // ns RDF
@@ -17,9 +17,11 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // forward declarations
+class TEntryList;
 class TTree;
 class TTreeReader;
 class TDirectory;
@@ -28,6 +30,7 @@ namespace ROOT {
 namespace RDF {
 class RCutFlowReport;
 class RDataSource;
+class RProfileReport;
 } // ns RDF
 
 namespace Internal {
@@ -36,6 +39,7 @@ std::vector<std::string> GetBranchNames(TTree &t, bool allowDuplicates = true);
 
 class RActionBase;
 class GraphNode;
+class RLoopProfiler;
 
 namespace GraphDrawing {
 class GraphCreatorHelper;
@@ -48,6 +52,7 @@ namespace RDF {
 namespace RDFInternal = ROOT::Internal::RDF;
 
 class RFilterBase;
+class RMergeableValueBase;
 class RRangeBase;
 using ROOT::RDF::RDataSource;
 using ColumnNames_t = std::vector<std::string>;
@@ -114,6 +119,17 @@ class RLoopManager : public RNodeBase {
    std::vector<TCallback> fCallbacks;                      ///< Registered callbacks
    std::vector<TOneTimeCallback> fCallbacksOnce; ///< Registered callbacks to invoke just once before running the loop
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Directory of the on-disk persistent cache used by Cache(). Empty if the persistent cache is disabled.
+   std::string fCacheDirectory;
+   /// User-provided version of the persistent cache entries, see RInterface::SetCacheDirectory
+   std::string fCacheVersion;
+   unsigned int fNCacheCalls{0}; ///< Number of Cache() calls booked, part of the persistent cache keys
+   /// Whether the event loops record the information returned by GetProfileReport, see RInterface::SetProfiling
+   bool fProfiling{false};
+   /// Per-slot timings and I/O counters of the profiled event loops. Created when profiling is first enabled.
+   std::unique_ptr<RDFInternal::RLoopProfiler> fLoopProfiler;
+   /// Number of worker processes that run the event loops, see RInterface::SetNProcesses. 0 and 1 run them in-process.
+   unsigned int fNProcesses{0};
 
    /// Registry of per-slot value pointers for booked data-source columns
    std::map<std::string, std::vector<void *>> fDSValuePtrMap;
@@ -123,11 +139,14 @@ class RLoopManager : public RNodeBase {
 
    void CheckIndexedFriends();
    void RunEmptySourceMT();
-   void RunEmptySource();
+   void RunEmptySource(ULong64_t begin, ULong64_t end);
    void RunTreeProcessorMT();
-   void RunTreeReader();
+   void RunTreeReader(TTree &tree, TEntryList *entryList, Long64_t begin, Long64_t end);
    void RunDataSourceMT();
-   void RunDataSource();
+   void RunDataSource(unsigned int worker = 0, unsigned int nWorkers = 1);
+   void CheckMultiProcess();
+   std::vector<std::unique_ptr<RMergeableValueBase>> RunMultiProcess();
+   std::string RunWorker(unsigned int worker, std::pair<ULong64_t, ULong64_t> range);
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
@@ -141,6 +160,7 @@ public:
    RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches);
    RLoopManager(const RLoopManager &) = delete;
    RLoopManager &operator=(const RLoopManager &) = delete;
+   ~RLoopManager();
 
    void JitDeclarations();
    void Jit();
@@ -170,12 +190,30 @@ public:
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   const std::string &GetCacheDirectory() const { return fCacheDirectory; }
+   const std::string &GetCacheVersion() const { return fCacheVersion; }
+   void SetCacheDirectory(const std::string &directory, const std::string &version)
+   {
+      fCacheDirectory = directory;
+      fCacheVersion = version;
+   }
+   unsigned int GetNCacheCalls() const { return fNCacheCalls; }
+   void IncrNCacheCalls() { ++fNCacheCalls; }
+   bool IsProfiling() const { return fProfiling; }
+   /// For the nodes that do not hold a pointer to the RLoopManager, see RDefineBase
+   const bool &GetProfilingFlag() const { return fProfiling; }
+   void SetProfiling(bool profiling);
+   ROOT::RDF::RProfileReport GetProfileReport();
+   unsigned int GetNProcesses() const { return fNProcesses; }
+   void SetNProcesses(unsigned int nProcesses) { fNProcesses = nProcesses; }
    bool HasDSValuePtrs(const std::string &col) const;
    const std::map<std::string, std::vector<void *>> &GetDSValuePtrs() const { return fDSValuePtrMap; }
    void AddDSValuePtrs(const std::string &col, const std::vector<void *> ptrs);
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
+   /// End of recursive chain of calls, does nothing
+   void AddCacheKeys(std::vector<std::string> &) {}
    /// For each booked filter, returns either the name or "Unnamed Filter"
    std::vector<std::string> GetFiltersNames();
 
@@ -189,6 +227,9 @@ public:
    std::vector<RDFInternal::RActionBase *> GetBookedActions() { return fBookedActions; }
    std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph();
 
+   /// The dataset itself is never varied
+   const ROOT::Internal::RDF::RVariationKeys &GetVariationKeys() final;
+
    const ColumnNames_t &GetBranchNames();
 };
 
@@ -57,6 +57,18 @@ public:
       (classTBufferFile.html#a209078a4cb58373b627390790bf0c9c1)
    */
    RMergeableValueBase() = default;
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Aggregate the information contained in another mergeable of the
+   ///        same action into this.
+   /// \param[in] other Another RMergeableValueBase object.
+   /// \throws std::invalid_argument If the other object holds the result of a
+   ///         different type of action.
+   ///
+   /// Counterpart of [MergeValues]
+   /// (namespaceROOT_1_1Detail_1_1RDF.html#af16fefbe2d120983123ddf8a1e137277)
+   /// for mergeables whose value type is only known at runtime, e.g. those read
+   /// back from a buffer sent by another process.
+   virtual void MergeAny(const RMergeableValueBase &other) = 0;
 };
 
 /**
@@ -164,6 +176,14 @@ public:
    /////////////////////////////////////////////////////////////////////////////
    /// \brief Retrieve the result wrapped by this mergeable.
    const T &GetValue() const { return fValue; }
+
+   void MergeAny(const RMergeableValueBase &other) final
+   {
+      const auto othercast = dynamic_cast<const RMergeableValue<T> *>(&other);
+      if (!othercast)
+         throw std::invalid_argument("Results from different actions cannot be merged together.");
+      Merge(*othercast);
+   }
 };
 
 /**
@@ -24,6 +24,7 @@ class RCutFlowReport;
 
 namespace Internal {
 namespace RDF {
+class RVariationKeys;
 namespace GraphDrawing {
 class GraphNode;
 }
@@ -53,8 +54,13 @@ public:
    virtual void IncrChildrenCount() = 0;
    virtual void StopProcessing() = 0;
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Add a description of each filter and range of this branch of the graph, jitted expressions included, to `keys`.
+   /// Used for the keys of the persistent cache of Cache(). Does not trigger jitting.
+   virtual void AddCacheKeys(std::vector<std::string> &keys) = 0;
    // Helper function for SaveGraph
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   /// Return the systematic variations that affect the selection of entries of this node. Only valid after jitting.
+   virtual const ROOT::Internal::RDF::RVariationKeys &GetVariationKeys() = 0;
 
    virtual void ResetChildrenCount()
    {
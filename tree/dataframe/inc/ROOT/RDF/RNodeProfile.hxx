@@ -0,0 +1,140 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILE
+#define ROOT_RDF_RNODEPROFILE
+
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Whether the calling thread is running an event loop with profiling enabled, see RLoopManager::SetProfiling.
+bool IsProfilingActive();
+/// Set whether the calling thread is running an event loop with profiling enabled.
+void SetProfilingActive(bool active);
+
+/// Per-slot profiling counters of a node of the computation graph
+struct RProfileCounters {
+   ULong64_t fNCalls = 0; ///< Number of evaluations of the node
+   double fTime = 0.;     ///< Exclusive wall time spent in the node, in seconds
+};
+
+/// Profiling counters of a processing slot, summed over the tasks it ran
+struct RSlotProfile {
+   ULong64_t fNEntries = 0;      ///< Number of entries processed
+   double fRealTime = 0.;        ///< Wall time spent running tasks, in seconds
+   ULong64_t fBytesRead = 0;     ///< Bytes read from ROOT files
+   ULong64_t fReadCalls = 0;     ///< Number of read calls issued to ROOT files
+   double fReadTime = 0.;        ///< Wall time spent reading from ROOT files, in seconds
+   ULong64_t fUnzippedBytes = 0; ///< Size of the TTree baskets after decompression
+   double fUnzipTime = 0.;       ///< Wall time spent decompressing TTree baskets, in seconds
+};
+
+// clang-format off
+/**
+\class ROOT::Internal::RDF::RNodeProfile
+\ingroup dataframe
+\brief The profiling counters of a Filter, Define or action, one set of counters per processing slot.
+
+The counters are only updated while profiling is active, see RProfileScope and RInterface::SetProfiling.
+*/
+// clang-format on
+class RNodeProfile {
+   std::vector<RProfileCounters> fCounters; ///< Indexed by slot * CacheLineStep, to avoid false sharing
+
+public:
+   explicit RNodeProfile(unsigned int nSlots) : fCounters(nSlots * CacheLineStep<RProfileCounters>()) {}
+
+   void Add(unsigned int slot, ULong64_t nCalls, double time)
+   {
+      auto &c = fCounters[slot * CacheLineStep<RProfileCounters>()];
+      c.fNCalls += nCalls;
+      c.fTime += time;
+   }
+
+   unsigned int GetNSlots() const { return fCounters.size() / CacheLineStep<RProfileCounters>(); }
+   const RProfileCounters &GetCounters(unsigned int slot) const
+   {
+      return fCounters[slot * CacheLineStep<RProfileCounters>()];
+   }
+
+   /// Return the counters summed over all slots
+   RProfileCounters GetTotal() const
+   {
+      RProfileCounters total;
+      for (auto slot = 0u; slot < GetNSlots(); ++slot) {
+         total.fNCalls += GetCounters(slot).fNCalls;
+         total.fTime += GetCounters(slot).fTime;
+      }
+      return total;
+   }
+};
+
+// clang-format off
+/**
+\class ROOT::Internal::RDF::RProfileScope
+\ingroup dataframe
+\brief Adds the wall time elapsed during its lifetime to a RNodeProfile, if profiling is active.
+
+Scopes nest: the time spent in inner scopes, e.g. in a Define evaluated while reading the inputs of a Filter, is
+subtracted from the outer scope, so that every node is only charged with its exclusive time.
+
+The first argument of the constructor is the profiling flag of the RLoopManager the node belongs to: when profiling
+is disabled, a scope costs a single test of that flag.
+*/
+// clang-format on
+class RProfileScope {
+   using Clock_t = std::chrono::steady_clock;
+
+   RNodeProfile *fProfile; ///< Null if profiling is not active
+   unsigned int fSlot;
+   ULong64_t fNCalls;
+   double fOuterChildTime = 0.; ///< Time of the inner scopes of the enclosing scope, restored at destruction
+   Clock_t::time_point fStart;
+
+   /// Time spent in the inner scopes of the innermost scope open in the calling thread
+   static double &ChildTime();
+
+public:
+   RProfileScope(bool isProfiling, RNodeProfile &profile, unsigned int slot, ULong64_t nCalls = 1)
+      : fProfile(isProfiling && IsProfilingActive() ? &profile : nullptr), fSlot(slot), fNCalls(nCalls)
+   {
+      if (!fProfile)
+         return;
+      auto &childTime = ChildTime();
+      fOuterChildTime = childTime;
+      childTime = 0.;
+      fStart = Clock_t::now();
+   }
+
+   RProfileScope(const RProfileScope &) = delete;
+   RProfileScope &operator=(const RProfileScope &) = delete;
+
+   ~RProfileScope()
+   {
+      if (!fProfile)
+         return;
+      const double elapsed = std::chrono::duration<double>(Clock_t::now() - fStart).count();
+      auto &childTime = ChildTime();
+      fProfile->Add(fSlot, fNCalls, elapsed - childTime);
+      childTime = fOuterChildTime + elapsed;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNODEPROFILE
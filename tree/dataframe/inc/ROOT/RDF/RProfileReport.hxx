@@ -0,0 +1,105 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // namespace RDF
+} // namespace Detail
+
+namespace RDF {
+
+/// The profiling information of a single Filter, Define or action, see RProfileReport.
+class RNodeProfileInfo {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+   std::string fKind; ///< "Define", "Filter" or "Action"
+   std::string fName; ///< Name of the defined column, of the filter or of the action
+   std::vector<ROOT::Internal::RDF::RProfileCounters> fCounters; ///< One element per processing slot
+
+   RNodeProfileInfo(const std::string &kind, const std::string &name, const ROOT::Internal::RDF::RNodeProfile &p);
+
+public:
+   const std::string &GetKind() const { return fKind; }
+   const std::string &GetName() const { return fName; }
+   unsigned int GetNSlots() const { return fCounters.size(); }
+   /// Number of evaluations of the node in the given slot
+   ULong64_t GetNCalls(unsigned int slot) const { return fCounters[slot].fNCalls; }
+   /// Exclusive wall time spent in the node in the given slot, in seconds
+   double GetTime(unsigned int slot) const { return fCounters[slot].fTime; }
+   /// Number of evaluations of the node, summed over all slots
+   ULong64_t GetNCalls() const;
+   /// Exclusive wall time spent in the node, summed over all slots, in seconds
+   double GetTime() const;
+};
+
+// clang-format off
+/**
+\class ROOT::RDF::RProfileReport
+\ingroup dataframe
+\brief The profiling information of the event loops run with profiling enabled, see RInterface::SetProfiling.
+
+Node times are exclusive: the time spent evaluating a Define while reading the inputs of a Filter or of an action
+is charged to the Define only. Times are summed over processing slots, so in multi-thread event loops they can be
+larger than the wall time of the event loop.
+*/
+// clang-format on
+class RProfileReport {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+   std::vector<RNodeProfileInfo> fNodes;
+   std::vector<ROOT::Internal::RDF::RSlotProfile> fSlots; ///< One element per processing slot
+   unsigned int fNRuns = 0; ///< Number of profiled event loops
+   double fRealTime = 0.;   ///< Wall time of the profiled event loops, in seconds
+   double fCpuTime = 0.;    ///< CPU time of the process during the profiled event loops, in seconds
+
+   template <typename T>
+   T Sum(T ROOT::Internal::RDF::RSlotProfile::*member) const
+   {
+      T total = 0;
+      for (const auto &s : fSlots)
+         total += s.*member;
+      return total;
+   }
+
+public:
+   using const_iterator = typename std::vector<RNodeProfileInfo>::const_iterator;
+   const_iterator begin() const { return fNodes.begin(); }
+   const_iterator end() const { return fNodes.end(); }
+
+   unsigned int GetNRuns() const { return fNRuns; }
+   double GetRealTime() const { return fRealTime; }
+   double GetCpuTime() const { return fCpuTime; }
+   ULong64_t GetNEntries() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fNEntries); }
+   ULong64_t GetBytesRead() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fBytesRead); }
+   ULong64_t GetReadCalls() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fReadCalls); }
+   double GetReadTime() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fReadTime); }
+   ULong64_t GetUnzippedBytes() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fUnzippedBytes); }
+   double GetUnzipTime() const { return Sum(&ROOT::Internal::RDF::RSlotProfile::fUnzipTime); }
+
+   /// Print the event loop summary and the nodes, most expensive first.
+   void Print() const;
+   /// Return the full report, including the per-slot break-down, as a JSON string.
+   std::string AsJSON() const;
+};
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILEREPORT
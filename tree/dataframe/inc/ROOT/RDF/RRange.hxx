@@ -13,9 +13,11 @@
 
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 #include "RtypesCore.h"
 
 #include <memory>
+#include <stdexcept>
 
 namespace ROOT {
 
@@ -96,8 +98,23 @@ public:
          fPrevData.IncrChildrenCount();
    }
 
+   /// Ranges select entries based on the count of the entries that passed the upstream filters: they cannot be
+   /// evaluated for a systematic variation that affects the upstream filters.
+   const ROOT::Internal::RDF::RVariationKeys &GetVariationKeys() final
+   {
+      const auto &keys = fPrevData.GetVariationKeys();
+      if (!keys.IsEmpty())
+         throw std::logic_error("Systematic variations cannot affect the filters upstream of a Range.");
+      return keys;
+   }
+
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+   void AddCacheKeys(std::vector<std::string> &keys) final
+   {
+      fPrevData.AddCacheKeys(keys);
+      keys.push_back("range: " + std::to_string(fStart) + ' ' + std::to_string(fStop) + ' ' + std::to_string(fStride));
+   }
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
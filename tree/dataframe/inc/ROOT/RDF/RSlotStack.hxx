@@ -11,9 +11,9 @@
 #ifndef ROOT_RSLOTSTACK
 #define ROOT_RSLOTSTACK
 
-#include <ROOT/TSpinMutex.hxx>
-
-#include <stack>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
@@ -23,11 +23,20 @@ namespace RDF {
 /// indexed by thread ids.
 /// WARNING: this class does not work as a regular stack. The size is
 /// fixed at construction time and no blocking is foreseen.
+///
+/// Slots are handed out without locks: free slots are the set bits of a bitmask, claimed with compare-and-swap.
+/// Threads get back the slot they used last whenever it is free, so that the per-slot data of the computation
+/// graph (e.g. the per-slot histogram copies of the actions) stays in the caches and in the NUMA domain of the
+/// thread that first touched it.
 class RSlotStack {
 private:
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
-   ROOT::TSpinMutex fMutex;
+   /// One bit per slot, set while the slot is free: slot `i` is bit `i % 64` of word `i / 64`
+   std::unique_ptr<std::atomic<std::uint64_t>[]> fFreeSlots;
+   /// Number of free slots. Decremented before claiming a bit, so a successful decrement guarantees a free slot.
+   std::atomic<int> fNFree;
+
+   bool TryGetSlot(unsigned int slot);
 
 public:
    RSlotStack() = delete;
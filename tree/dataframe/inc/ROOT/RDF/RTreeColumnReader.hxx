@@ -21,22 +21,77 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+class TBranch;
+class TBufferFile;
+class TTree;
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Reads the values of a fundamental-type column one basket at a time, via TBranch::GetBulkRead().
+///
+/// Only branches with a single leaf holding one value of exactly the column type, stored in baskets written to the
+/// file, are supported. As soon as this is not the case, Get() returns nullptr and the column must be read via
+/// TTreeReaderValue instead.
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader {
+   TTreeReader &fReader;
+   const std::string fColName;
+   const std::type_info &fType;
+   const std::size_t fSize; ///< Size of a value of the column type
+   TTree *fTree = nullptr;  ///< The tree the branch belongs to
+   Int_t fTreeNumber = -1;  ///< The number of fTree in the chain
+   TBranch *fBranch = nullptr;
+   std::unique_ptr<TBufferFile> fBuffer; ///< The basket being read, deserialized
+   std::vector<Long64_t> fAligned;       ///< Copy of the values of the basket, if they are not aligned in fBuffer
+   char *fValues = nullptr;              ///< The values of the basket, either in fBuffer or in fAligned
+   Long64_t fFirstEntry = -1;            ///< The first entry of the basket
+   Long64_t fEndEntry = -1;              ///< The entry after the last one of the basket
+
+   bool SetBranch();
+   bool ReadBasket(Long64_t entry);
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName, const std::type_info &type, std::size_t size);
+   ~RTreeBulkColumnReader();
+   /// Return the address of the value of the current entry, or nullptr if the column cannot be read in bulk.
+   void *Get();
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderValues
+///
+/// Columns of fundamental types are read one basket at a time where possible, see RTreeBulkColumnReader, which avoids
+/// the per-entry overhead of TBranch::GetEntry on flat trees. Otherwise, and as soon as the bulk read of a basket is
+/// not possible, the column is read via the TTreeReaderValue.
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+   std::unique_ptr<RTreeBulkColumnReader> fBulkReader; ///< Null if the column is not read in bulk
+
+   static constexpr bool fgCanReadInBulk =
+      std::is_arithmetic<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= sizeof(Long64_t);
+
+   void *GetImpl(Long64_t) final
+   {
+      if (fBulkReader) {
+         if (auto value = fBulkReader->Get())
+            return value;
+         fBulkReader.reset();
+      }
+      return fTreeValue->Get();
+   }
 
-   void *GetImpl(Long64_t) final { return fTreeValue->Get(); }
 public:
    /// Construct the RTreeColumnReader. Actual initialization is performed lazily by the Init method.
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
       : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str()))
    {
+      if (fgCanReadInBulk)
+         fBulkReader = std::make_unique<RTreeBulkColumnReader>(r, colName, typeid(T), sizeof(T));
    }
 
    /// The dtor resets the TTreeReaderValue object.
@@ -0,0 +1,138 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATION
+#define ROOT_RDF_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RVec.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+// clang-format off
+/**
+\class ROOT::Internal::RDF::RVariation
+\ingroup dataframe
+\brief A systematic variation of a column, computed by a callable that returns all the varied values as an RVec.
+\tparam F The type of the callable, which must return an RVec with one element per variation tag
+*/
+// clang-format on
+template <typename F>
+class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename CallableTraits<F>::ret_type;
+   using Value_t = typename ret_type::value_type;
+   // RVec<bool> is a std::vector<bool>, whose elements cannot be addressed: the varied values are copied into a
+   // std::deque in that case.
+   using ValuesPerSlot_t =
+      typename std::conditional<std::is_same<Value_t, bool>::value, std::deque<Value_t>, std::vector<Value_t>>::type;
+
+   static_assert(std::is_same<ret_type, ROOT::VecOps::RVec<Value_t>>::value,
+                 "The callable passed to Vary must return an RVec with one varied value per variation tag");
+
+   F fExpression;
+   const std::vector<std::string> fInputColumns;
+   std::vector<ValuesPerSlot_t> fLastResults;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto &results = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      if (results.size() != fTags.size()) {
+         throw std::runtime_error("The expression of the variation \"" + fVariationName + "\" of column \"" +
+                                  fColumnName + "\" returned " + std::to_string(results.size()) +
+                                  " values, but the variation has " + std::to_string(fTags.size()) + " tags.");
+      }
+      auto &lastResults = fLastResults[slot * CacheLineStep<ValuesPerSlot_t>()];
+      lastResults.assign(results.begin(), results.end());
+      // silence "unused parameter" warnings in gcc
+      (void)slot;
+      (void)entry;
+   }
+
+public:
+   RVariation(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const std::vector<std::string> &inputColumns, unsigned int nSlots,
+              const RBookedDefines &defines, const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+              ROOT::RDF::RDataSource *ds)
+      : RVariationBase(columnName, variationName, tags, type, nSlots, defines, DSValuePtrs, ds),
+        fExpression(std::move(expression)), fInputColumns(inputColumns),
+        fLastResults(fNSlots * CacheLineStep<ValuesPerSlot_t>()), fValues(fNSlots), fIsDefine()
+   {
+      const auto nColumns = fInputColumns.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fInputColumns[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         RColumnReadersInfo info{fInputColumns, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
+         fValues[slot] = MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t tagIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot * CacheLineStep<ValuesPerSlot_t>()][tagIdx]);
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(Value_t); }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot * CacheLineStep<Long64_t>()]) {
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = entry;
+      }
+   }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATION
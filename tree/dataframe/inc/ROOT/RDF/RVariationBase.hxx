@@ -0,0 +1,126 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONBASE
+#define ROOT_RDF_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Internal {
+namespace RDF {
+
+/// Return the key of the variation that is being evaluated by the calling thread, 0 for the nominal values.
+/// See RVariedAction.
+unsigned int GetActiveVariationKey();
+/// Set the key of the variation that is being evaluated by the calling thread, 0 for the nominal values.
+void SetActiveVariationKey(unsigned int key);
+
+// clang-format off
+/**
+\class ROOT::Internal::RDF::RVariationBase
+\ingroup dataframe
+\brief Base class for the systematic variations of a column, see RInterface::Vary.
+
+A variation evaluates all the varied values of a column for an entry at once. Each varied value, i.e. each tag of the
+variation, is identified in the event loop by a key that is unique across all variations of all computation graphs.
+While an RVariedAction evaluates one of the keys, the RVariationReader of the varied column returns the corresponding
+varied value instead of the nominal one.
+*/
+// clang-format on
+class RVariationBase {
+protected:
+   const std::string fColumnName;        ///< The name of the varied column
+   const std::string fVariationName;     ///< The name of the systematic variation, e.g. "pt_scale"
+   const std::vector<std::string> fTags; ///< The tags of the varied values, e.g. "up" and "down"
+   const std::string fType;              ///< The type of the varied column as a text string
+   const unsigned int fFirstKey;         ///< The keys of the variation are [fFirstKey, fFirstKey + fTags.size())
+   const unsigned int fNSlots;           ///< Number of thread slots used by this node
+   std::vector<Long64_t> fLastCheckedEntry;
+   RBookedDefines fDefines;
+   std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   ROOT::RDF::RDataSource *fDataSource; ///< Non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+
+   static unsigned int RegisterKeys(std::size_t nKeys);
+
+public:
+   RVariationBase(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, unsigned int nSlots, const RBookedDefines &defines,
+                  const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Return the (type-erased) address of the varied value with the given tag index for the given processing slot.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t tagIdx) = 0;
+   /// Return the type of the varied values, i.e. of the column
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Update the varied values for the given entry
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetVariationName() const { return fVariationName; }
+   const std::vector<std::string> &GetTags() const { return fTags; }
+   std::string GetTypeName() const { return fType; }
+   unsigned int GetFirstKey() const { return fFirstKey; }
+   bool HasKey(unsigned int key) const { return key - fFirstKey < fTags.size(); }
+};
+
+/// The set of variations that affect the values computed by a node of the computation graph.
+/// Nodes memoize their values per entry and per active variation key, but only for the keys of the variations that
+/// affect them: values that do not depend on a variation are shared by the nominal and the varied computations.
+class RVariationKeys {
+   /// Non-owning, sorted by key. The variations are kept alive by the RBookedDefines of the nodes.
+   std::vector<const RVariationBase *> fVariations;
+
+public:
+   bool IsEmpty() const { return fVariations.empty(); }
+   const std::vector<const RVariationBase *> &GetVariations() const { return fVariations; }
+   void Merge(const RVariationKeys &other);
+   void Add(const RVariationBase &variation);
+
+   /// Return the active variation key if it belongs to one of the variations in this set, 0 otherwise.
+   unsigned int GetActiveKey() const
+   {
+      if (fVariations.empty())
+         return 0;
+      const auto key = GetActiveVariationKey();
+      for (auto variation : fVariations) {
+         if (variation->HasKey(key))
+            return key;
+      }
+      return 0;
+   }
+};
+
+/// Return the variations that affect the given columns: those of the varied columns and those that affect the
+/// inputs of the defined columns, recursively.
+RVariationKeys GetColumnVariationKeys(const std::vector<std::string> &columns, const RBookedDefines &defines);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATIONBASE
@@ -0,0 +1,63 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONREADER
+#define ROOT_RDF_RVARIATIONREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RVariationBase.hxx"
+#include "Utils.hxx" // TypeID2TypeName
+#include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Column reader for a column with systematic variations.
+/// It returns the varied value if the active variation key (see GetActiveVariationKey) belongs to the variation,
+/// and the value of the wrapped nominal column reader otherwise.
+template <typename T>
+class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the node responsible for the varied values.
+   RVariationBase &fVariation;
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fNominalReader;
+   /// The slot this value belongs to.
+   unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      const auto key = GetActiveVariationKey();
+      if (!fVariation.HasKey(key))
+         return &fNominalReader->template Get<T>(entry);
+      fVariation.Update(fSlot, entry);
+      return fVariation.GetValuePtr(fSlot, key - fVariation.GetFirstKey());
+   }
+
+public:
+   RVariationReader(unsigned int slot, RVariationBase &variation,
+                    std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> nominalReader)
+      : fVariation(variation), fNominalReader(std::move(nominalReader)), fSlot(slot)
+   {
+      if (variation.GetTypeId() != typeid(T)) {
+         throw std::runtime_error("The varied column \"" + variation.GetColumnName() + "\" has type " +
+                                  variation.GetTypeName() + " but is being read as " +
+                                  TypeID2TypeName(typeid(T)) + ".");
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATIONREADER
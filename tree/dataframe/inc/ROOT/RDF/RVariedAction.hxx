@@ -0,0 +1,198 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIEDACTION
+#define ROOT_RVARIEDACTION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/GraphNode.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility> // std::index_sequence
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
+
+namespace GraphDrawing {
+std::shared_ptr<GraphNode> AddDefinesToGraph(std::shared_ptr<GraphNode> node,
+                                             const RDFInternal::RBookedDefines &defines,
+                                             const std::vector<std::string> &prevNodeDefines);
+} // namespace GraphDrawing
+
+// clang-format off
+/**
+ * \class ROOT::Internal::RDF::RVariedAction
+ * \ingroup dataframe
+ * \brief A RDataFrame node that produces the results of an action for each key of its systematic variations
+ * \tparam Helper The action helper type, which implements the concrete action logic (e.g. FillHelper)
+ * \tparam PrevDataFrame The type of the parent node in the computation graph
+ * \tparam ColumnTypes_t A TypeList with the types of the input columns
+ *
+ * For each entry, the action is evaluated once per variation key, with one helper per key. While a key is being
+ * evaluated it is set as the active variation key of the thread, so that upstream filters, defines and varied columns
+ * return the corresponding varied values. See ROOT::RDF::Experimental::VariationsFor.
+ */
+// clang-format on
+template <typename Helper, typename PrevDataFrame, typename ColumnTypes_t>
+class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+
+   /// Resets the active variation key when going out of scope, also in case of exceptions.
+   struct RActiveKeyGuard {
+      ~RActiveKeyGuard() { SetActiveVariationKey(0); }
+   };
+
+   std::vector<Helper> fHelpers; ///< One helper per variation key
+   const std::vector<unsigned int> fKeys;
+   const std::shared_ptr<PrevDataFrame> fPrevDataPtr;
+   PrevDataFrame &fPrevData;
+   /// Column readers per slot and per input column, shared by all helpers
+   std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void CallExec(std::size_t helperIdx, unsigned int slot, Long64_t entry, TypeList<ColTypes...>,
+                 std::index_sequence<S...>)
+   {
+      fHelpers[helperIdx].Exec(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      (void)entry; // avoid "unused parameter" warnings
+   }
+
+public:
+   RVariedAction(std::vector<Helper> &&helpers, const std::vector<unsigned int> &keys, const ColumnNames_t &columns,
+                 std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
+      : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelpers(std::move(helpers)), fKeys(keys),
+        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine()
+   {
+      const auto nColumns = columns.size();
+      const auto &customCols = GetDefines();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = customCols.HasName(columns[i]);
+   }
+
+   RVariedAction(const RVariedAction &) = delete;
+   RVariedAction &operator=(const RVariedAction &) = delete;
+   // must call Deregister here, see ~RAction
+   ~RVariedAction() { fLoopManager->Deregister(this); }
+
+   void Initialize() final
+   {
+      for (auto &h : fHelpers)
+         h.Initialize();
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      for (auto &bookedBranch : GetDefines().GetColumns())
+         bookedBranch.second->InitSlot(r, slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->InitSlot(r, slot);
+      RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
+      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      for (auto &h : fHelpers)
+         h.InitTask(r, slot);
+   }
+
+   void Run(unsigned int slot, Long64_t entry) final
+   {
+      RActiveKeyGuard guard;
+      const auto nKeys = fKeys.size();
+      for (std::size_t i = 0u; i < nKeys; ++i) {
+         SetActiveVariationKey(fKeys[i]);
+         if (fPrevData.CheckFilters(slot, entry)) {
+            RProfileScope profileScope(fLoopManager->IsProfiling(), fProfile, slot);
+            CallExec(i, slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
+      }
+   }
+
+   void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
+
+   /// Clean-up operations to be performed at the end of a task.
+   void FinalizeSlot(unsigned int slot) final
+   {
+      for (auto &column : GetDefines().GetColumns())
+         column.second->FinaliseSlot(slot);
+      for (auto &variation : GetDefines().GetVariations())
+         variation.second->FinaliseSlot(slot);
+      for (auto &v : fValues[slot])
+         v.reset();
+      for (auto &h : fHelpers)
+         h.CallFinalizeTask(slot);
+   }
+
+   /// Clean-up and finalize the results of all variations.
+   void Finalize() final
+   {
+      for (auto &h : fHelpers)
+         h.Finalize();
+      SetHasRun();
+   }
+
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
+   std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
+   {
+      auto prevNode = fPrevData.GetGraph();
+      auto prevColumns = prevNode->GetDefinedColumns();
+
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(GetActionName());
+
+      auto upmostNode = AddDefinesToGraph(thisNode, GetDefines(), prevColumns);
+
+      thisNode->AddDefinedColumns(GetDefines().GetNames());
+      thisNode->SetAction(HasRun());
+      thisNode->SetProfile(GetProfile());
+      upmostNode->SetPrevNode(prevNode);
+      return thisNode;
+   }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      throw std::logic_error("Varied results cannot be merged.");
+   }
+
+   const std::type_info *GetMergeableValueType() const final { return nullptr; }
+
+   void SetFromMergeableValue(const RMergeableValueBase &) final
+   {
+      throw std::logic_error("Varied results cannot be merged.");
+   }
+
+   void *PartialUpdate(unsigned int) final { throw std::logic_error("Varied results do not support callbacks."); }
+
+   /// The variations have already been applied
+   RVariationKeys GetVariationKeys() final { return {}; }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&) final
+   {
+      throw std::logic_error("Cannot produce variations of varied results.");
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVARIEDACTION
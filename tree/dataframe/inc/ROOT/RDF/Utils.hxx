@@ -157,6 +157,11 @@ struct RemoveFirstTwoParametersIf<true, TypeList> {
 template <bool MustRemove, typename TypeList>
 using RemoveFirstTwoParametersIf_t = typename RemoveFirstTwoParametersIf<MustRemove, TypeList>::type;
 
+/// `value` is true if all the conditions are true, or if there are none
+template <bool... Conditions>
+using RAllOf_t = std::is_same<TypeList<std::integral_constant<bool, Conditions>..., std::true_type>,
+                              TypeList<std::true_type, std::integral_constant<bool, Conditions>...>>;
+
 /// Detect whether a type is an instantiation of RVec<T>
 template <typename>
 struct IsRVec_t : public std::false_type {};
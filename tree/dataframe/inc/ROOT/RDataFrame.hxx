@@ -18,6 +18,7 @@ ROOT's RDataFrame allows to analyse data stored in TTrees with a high level inte
 
 #include "TROOT.h" // To allow ROOT::EnableImplicitMT without including ROOT.h
 #include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/RResultMap.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h"
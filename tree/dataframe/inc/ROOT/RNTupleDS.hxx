@@ -55,7 +55,13 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<size_t> fActiveColumns;
 
    unsigned fNSlots = 0;
+   /// Whether the first source is attached and the columns are known.  A data source created for an ntuple that
+   /// is not written yet (see RDataFrame::Snapshot) attaches on first use.
+   bool fIsAttached = false;
    bool fHasSeenAllRanges = false;
+   /// The entry ranges [begin, end) that remain after the selections made by SelectRange()
+   std::vector<std::pair<ULong64_t, ULong64_t>> fSelectedRanges;
+   bool fHasSelection = false;
 
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
@@ -69,12 +75,25 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
                  std::string_view colName,
                  DescriptorId_t fieldId,
                  std::vector<DescriptorId_t> skeinIDs);
+   /// Attaches the first source, collects the columns and creates the sources of the other slots
+   void Attach();
+   void EnsureAttached() const
+   {
+      if (!fIsAttached)
+         const_cast<RNTupleDS *>(this)->Attach();
+   }
 
 public:
-   explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// If attachLazily is true, the page source is only attached once the data source is used, which allows for
+   /// creating the data source of an ntuple that is not written yet.
+   explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource, bool attachLazily = false);
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
-   const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
+   const std::vector<std::string> &GetColumnNames() const final
+   {
+      EnsureAttached();
+      return fColumnNames;
+   }
    bool HasColumn(std::string_view colName) const final;
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
@@ -82,6 +101,12 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Restricts the event loop to the entry ranges in which the values of the given RNTuple field may lie within
+   /// [min, max], according to the value statistics stored with the data (see RNTupleDescriptor::FindEntryRanges()).
+   /// For collections, the values are the collection sizes.  Several selections are combined with a logical AND.
+   /// Pruning is conservative: a corresponding Filter() is still needed in order to select individual entries.
+   void SelectRange(std::string_view fieldName, double min, double max);
+
    void Initialise() final;
    void Finalise() final;
 
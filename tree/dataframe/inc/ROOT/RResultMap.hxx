@@ -0,0 +1,119 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RStringView.hxx"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+// clang-format off
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief A container for the nominal and varied results of an RDataFrame action, see VariationsFor().
+\tparam T Type of the action result
+
+The results are indexed by "nominal" and by "<variation name>:<variation tag>", e.g. "pt:up".
+As for RResultPtr, accessing any of the results triggers the event loop if needed.
+*/
+// clang-format on
+template <typename T>
+class RResultMap {
+   std::vector<std::string> fKeys; ///< The keys of the results, in the order of the varied action
+   std::map<std::string, RResultPtr<T>> fResults;
+
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   RResultMap(std::vector<std::string> &&keys, std::map<std::string, RResultPtr<T>> &&results)
+      : fKeys(std::move(keys)), fResults(std::move(results))
+   {
+   }
+
+public:
+   /// Return the result with the given key. Throws if the key is unknown.
+   RResultPtr<T> &operator[](std::string_view key)
+   {
+      auto it = fResults.find(std::string(key));
+      if (it == fResults.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + std::string(key) + "\".");
+      return it->second;
+   }
+
+   /// Return all keys, "nominal" first.
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Produce all required systematic variations for the given result.
+/// \param[in] resPtr The nominal result of an action booked downstream of one or more calls to RInterface::Vary.
+/// \return A RResultMap with the nominal result and one result per variation tag.
+///
+/// The varied results are computed in the same event loop as the nominal one. Only the variations that affect the
+/// inputs of the action, directly or through upstream Filters and Defines, produce varied results.
+/// VariationsFor must be called before the event loop producing `resPtr` has run.
+/// Varied results do not support callbacks and cannot be retrieved as mergeable values.
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   if (resPtr.fActionPtr == nullptr)
+      throw std::runtime_error("VariationsFor: the RResultPtr is null.");
+   if (resPtr.IsReady())
+      throw std::runtime_error("VariationsFor: the event loop producing the result has already run.");
+
+   auto &lm = *resPtr.fLoopManager;
+   // jitted actions only know their inputs once their concrete type has been jitted
+   lm.Jit();
+
+   std::vector<std::string> keys{"nominal"};
+   std::map<std::string, RResultPtr<T>> results;
+   results.emplace("nominal", resPtr);
+
+   const auto variationKeys = resPtr.fActionPtr->GetVariationKeys();
+   std::vector<std::shared_ptr<T>> variedResults;
+   for (auto variation : variationKeys.GetVariations()) {
+      for (const auto &tag : variation->GetTags()) {
+         keys.emplace_back(variation->GetVariationName() + ":" + tag);
+         variedResults.emplace_back(std::make_shared<T>(*resPtr.fObjPtr));
+      }
+   }
+   if (variedResults.empty())
+      return RResultMap<T>(std::move(keys), std::move(results));
+
+   std::vector<void *> resultAddresses;
+   for (auto &r : variedResults)
+      resultAddresses.emplace_back(&r);
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+      resPtr.fActionPtr->MakeVariedAction(std::move(resultAddresses));
+   lm.Book(variedAction.get());
+
+   for (auto i = 0u; i < variedResults.size(); ++i)
+      results.emplace(keys[i + 1], ROOT::Detail::RDF::MakeResultPtr(variedResults[i], lm, variedAction));
+
+   return RResultMap<T>(std::move(keys), std::move(results));
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
@@ -18,6 +18,14 @@
 namespace ROOT {
 
 namespace RDF {
+
+/// The data format in which Snapshot writes the selected columns
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT to be built with root7
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +45,9 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   /// Output data format.  For RNTuple outputs, fAutoFlush is used as the number of entries per cluster and
+   /// fSplitLevel is ignored.
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault;
 };
 } // ns RDF
 } // ns ROOT
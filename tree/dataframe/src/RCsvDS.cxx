@@ -65,9 +65,10 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+RCsvDS does not hold the whole CSV file in memory. The file is read in batches of complete lines,
+by default of about 8 MB per processing slot, or of `linesChunkSize` lines if this parameter of
+MakeCsvDataFrame is specified. Each batch is split in one entry range per slot, and the lines of each range
+are parsed by the slot that processes it, so that multi-thread event loops also parse the file in parallel.
 */
 // clang-format on
 
@@ -79,10 +80,99 @@ important to check both how much memory is available and the size of the CSV fil
 #include <TError.h>
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
 
+namespace {
+
+/// Size of the batches of lines read from the file by GetEntryRanges, per processing slot, if no lines chunk size
+/// is given
+constexpr std::size_t kBatchSizePerSlot = 8 * 1024 * 1024;
+/// Initial size of the batches. They grow up to kBatchSizePerSlot per slot, or until they contain the requested number
+/// of lines if a lines chunk size is given.
+constexpr std::size_t kMinBatchSize = 64 * 1024;
+
+/// Find the next non-empty line in [pos, end) of buf. On success, [lineBegin, lineEnd) is the line without its line
+/// break and pos is moved past the line break.
+bool FindLine(const char *buf, std::size_t &pos, std::size_t end, const char *&lineBegin, const char *&lineEnd)
+{
+   while (pos < end) {
+      const auto nl = static_cast<const char *>(std::memchr(buf + pos, '\n', end - pos));
+      lineBegin = buf + pos;
+      lineEnd = nl ? nl : buf + end;
+      pos = nl ? nl - buf + 1 : end;
+      if (lineEnd != lineBegin && *(lineEnd - 1) == '\r')
+         --lineEnd;
+      if (lineEnd != lineBegin)
+         return true;
+   }
+   return false;
+}
+
+/// Copy the field [begin, end) to out, replacing escaped quotes by one quote and dropping the other quotes
+void Unquote(const char *begin, const char *end, std::string &out)
+{
+   out.clear();
+   for (auto c = begin; c < end; ++c) {
+      if (*c != '"')
+         out += *c;
+      else if (c + 1 < end && c[1] == '"')
+         out += *++c;
+   }
+}
+
+/// Whether a conversion that stopped at strEnd consumed the whole field, except for trailing blanks
+bool IsEndOfField(const char *strEnd)
+{
+   while (*strEnd == ' ' || *strEnd == '\t')
+      ++strEnd;
+   return *strEnd == '\0';
+}
+
+bool ToNumber(char *str, double &value)
+{
+   char *strEnd;
+   value = std::strtod(str, &strEnd);
+   if (strEnd != str && (*strEnd == 'd' || *strEnd == 'D' || *strEnd == 'q' || *strEnd == 'Q')) {
+      // Fortran-style exponent, which type inference accepts (see fgDoubleRegex3) but strtod does not
+      *strEnd = 'e';
+      value = std::strtod(str, &strEnd);
+   }
+   return strEnd != str && IsEndOfField(strEnd);
+}
+
+bool ToNumber(char *str, Long64_t &value)
+{
+   char *strEnd;
+   errno = 0;
+   value = std::strtoll(str, &strEnd, 10);
+   return strEnd != str && errno != ERANGE && IsEndOfField(strEnd);
+}
+
+/// Convert the field [begin, end) to a number. Short fields are null-terminated on the stack, so that no memory is
+/// allocated; longer fields are copied to scratch, unless they were already unquoted there.
+template <typename T>
+bool ParseNumber(const char *begin, const char *end, std::string &scratch, T &value)
+{
+   if (begin == scratch.data())
+      return ToNumber(&scratch[0], value);
+   const std::size_t len = end - begin;
+   char buf[64];
+   if (len < sizeof(buf)) {
+      std::memcpy(buf, begin, len);
+      buf[len] = '\0';
+      return ToNumber(buf, value);
+   }
+   scratch.assign(begin, end);
+   return ToNumber(&scratch[0], value);
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -111,41 +201,6 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
-{
-   std::istringstream lineStream(line);
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
-
-      switch (colType) {
-      case 'd': {
-         record.emplace_back(new double(std::stod(col)));
-         break;
-      }
-      case 'l': {
-         record.emplace_back(new Long64_t(std::stoll(col)));
-         break;
-      }
-      case 'b': {
-         auto b = new bool();
-         record.emplace_back(b);
-         std::istringstream is(col);
-         is >> std::boolalpha >> *b;
-         break;
-      }
-      case 's': {
-         record.emplace_back(new std::string(col));
-         break;
-      }
-      }
-      ++i;
-   }
-}
-
 void RCsvDS::GenerateHeaders(size_t size)
 {
    for (size_t i = 0; i < size; ++i) {
@@ -258,6 +313,8 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
 /// \param[in] readHeaders `true` if the CSV file contains headers as first row, `false` otherwise
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
+/// \param[in] linesChunkSize Number of lines read from the file, and split among the processing slots, at a time.
+///                           By default (-1) batches of about 8 MB per slot are read.
 RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize) // TODO: Let users specify types?
    : fReadHeaders(readHeaders),
      fCsvFile(ROOT::Internal::RRawFile::Create(fileName)),
@@ -293,8 +350,8 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
       // Infer types of columns with first record
       InferColTypes(columns);
 
-      // rewind
-      fCsvFile->Seek(fDataPos);
+      // the data is read in batches from here, see ReadBatch
+      fReadPos = fDataPos;
    } else {
       std::string msg = "Could not infer column types of CSV file ";
       msg += fileName;
@@ -302,33 +359,14 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Release the memory held by the batch of lines read last.
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'd': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'l': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'b': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 's': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   std::vector<char>().swap(fBatch);
+   fChunks.clear();
+   for (auto &cursor : fSlotCursors)
+      cursor.fChunk = std::size_t(-1);
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -340,9 +378,8 @@ RCsvDS::~RCsvDS()
 
 void RCsvDS::Finalise()
 {
-   fCsvFile->Seek(fDataPos);
+   fReadPos = fDataPos;
    fProcessedLines = 0ULL;
-   fEntryRangesRequested = 0ULL;
    FreeRecords();
 }
 
@@ -351,49 +388,80 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
    return fHeaders;
 }
 
-std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
+////////////////////////////////////////////////////////////////////////
+/// Read the next batch of complete lines of the file into fBatch, starting at fReadPos.
+/// Only the line breaks are looked at here: the lines are parsed by the processing slots in SetEntry.
+/// \return The number of non-empty lines in the batch.
+ULong64_t RCsvDS::ReadBatch()
 {
+   const bool byLines = fLinesChunkSize >= 0;
+   if (fBatch.empty())
+      fBatch.resize(kMinBatchSize);
+   const std::size_t targetSize = kBatchSizePerSlot * fNSlots;
+
+   ULong64_t nLines = 0ULL;
+   auto enoughLines = [&] { return byLines && nLines == ULong64_t(fLinesChunkSize); };
+   std::size_t nBytes = 0; // bytes read into fBatch
+   std::size_t pos = 0;    // bytes of fBatch already split in lines
+   bool eof = false;
+   while (!eof && !enoughLines()) {
+      // Grow the batch if it is still small, if it does not contain enough lines yet, or if a single line does not fit
+      if (nBytes == fBatch.size())
+         fBatch.resize(2 * fBatch.size());
+      const auto nRead = fCsvFile->ReadAt(fBatch.data() + nBytes, fBatch.size() - nBytes, fReadPos + nBytes);
+      nBytes += nRead;
+      eof = nRead == 0;
+
+      // Only complete lines belong to the batch, except for the last line of the file
+      auto end = nBytes;
+      if (!eof) {
+         while (end > pos && fBatch[end - 1] != '\n')
+            --end;
+      }
+      const char *lineBegin, *lineEnd;
+      while (!enoughLines() && FindLine(fBatch.data(), pos, end, lineBegin, lineEnd))
+         ++nLines;
 
-   // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
-   FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
+      if (!byLines && nLines > 0 && nBytes == fBatch.size() && nBytes >= targetSize)
+         break;
    }
 
-   if (gDebug > 0) {
-      if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
-      } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
-      }
-   }
+   fReadPos += pos;
+   return nLines;
+}
 
+std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
+{
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
-   if (0 == nRecords)
-      return entryRanges;
+   fChunks.clear();
+   for (auto &cursor : fSlotCursors)
+      cursor.fChunk = std::size_t(-1);
 
-   const auto chunkSize = nRecords / fNSlots;
-   const auto remainder = 1U == fNSlots ? 0 : nRecords % fNSlots;
-   auto start = 0ULL == fEntryRangesRequested ? 0ULL : fProcessedLines;
-   auto end = start;
+   const auto nLines = ReadBatch();
+   if (0 == nLines)
+      return entryRanges;
 
+   // One range per slot with the same number of lines, the last range also gets the remainder
+   const auto chunkSize = nLines / fNSlots;
+   const auto endEntry = fProcessedLines + nLines;
+   std::size_t pos = 0;
+   auto start = fProcessedLines;
    for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
+      const auto end = i + 1 == fNSlots ? endEntry : start + chunkSize;
+      RChunk chunk{start, end, pos, pos};
+      const char *lineBegin, *lineEnd;
+      for (auto entry = start; entry < end; ++entry)
+         FindLine(fBatch.data(), pos, fBatch.size(), lineBegin, lineEnd);
+      chunk.fEnd = pos;
+      fChunks.emplace_back(chunk);
       entryRanges.emplace_back(start, end);
-      (void)i;
+      start = end;
    }
-   entryRanges.back().second += remainder;
 
-   fProcessedLines += nRecords;
-   fEntryRangesRequested++;
+   if (gDebug > 0)
+      Info("GetEntryRanges", "Read batch of %llu lines (%zu bytes) of CSV file", nLines, pos);
+
+   fProcessedLines = endEntry;
 
    return entryRanges;
 }
@@ -419,34 +487,109 @@ bool RCsvDS::HasColumn(std::string_view colName) const
    return fHeaders.end() != std::find(fHeaders.begin(), fHeaders.end(), colName);
 }
 
-bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
+////////////////////////////////////////////////////////////////////////
+/// Point the cursor of a slot to the beginning of the range of the current batch that contains the entry.
+void RCsvDS::MoveCursor(RSlotCursor &cursor, ULong64_t entry)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
-   int colIndex = 0;
-   for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+   for (auto i : ROOT::TSeqUL(fChunks.size())) {
+      const auto &chunk = fChunks[i];
+      if (chunk.fFirstEntry <= entry && entry < chunk.fEndEntry) {
+         cursor.fChunk = i;
+         cursor.fPos = chunk.fBegin;
+         cursor.fNextEntry = chunk.fFirstEntry;
+         return;
+      }
+   }
+   throw std::runtime_error("Entry " + std::to_string(entry) + " of the CSV file is not in the current batch");
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Parse the fields of the line [begin, end) into the values of the slot.
+/// Only string fields, and fields longer than a few tens of characters, may need to allocate memory.
+void RCsvDS::ParseLine(unsigned int slot, const char *begin, const char *end, ULong64_t entry)
+{
+   auto &scratch = fSlotCursors[slot * ROOT::Internal::RDF::CacheLineStep<RSlotCursor>()].fScratch;
+   auto pos = begin;
+   auto colIndex = 0U;
+   for (auto colType : fColTypesList) {
+      // Find the end of the field, following the same quoting rules as ParseValue
+      auto fieldEnd = pos;
+      bool quoted = false;
+      bool hasQuotes = false;
+      for (; fieldEnd < end; ++fieldEnd) {
+         if (*fieldEnd == '"') {
+            hasQuotes = true;
+            if (fieldEnd + 1 < end && fieldEnd[1] == '"')
+               ++fieldEnd;
+            else
+               quoted = !quoted;
+         } else if (*fieldEnd == fDelimiter && !quoted) {
+            break;
+         }
+      }
+
+      auto valBegin = pos;
+      auto valEnd = fieldEnd;
+      if (hasQuotes) {
+         auto &value = colType == 's' ? fStringEvtValues[colIndex][slot] : scratch;
+         Unquote(pos, fieldEnd, value);
+         valBegin = value.data();
+         valEnd = valBegin + value.size();
+      }
+
+      bool ok = true;
       switch (colType) {
       case 'd': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         ok = ParseNumber(valBegin, valEnd, scratch, fDoubleEvtValues[colIndex][slot]);
          break;
       }
       case 'l': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         ok = ParseNumber(valBegin, valEnd, scratch, fLong64EvtValues[colIndex][slot]);
          break;
       }
       case 'b': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         const std::size_t len = valEnd - valBegin;
+         if (len == 4 && std::memcmp(valBegin, "true", 4) == 0)
+            fBoolEvtValues[colIndex][slot] = true;
+         else if (len == 5 && std::memcmp(valBegin, "false", 5) == 0)
+            fBoolEvtValues[colIndex][slot] = false;
+         else
+            ok = false;
          break;
       }
       case 's': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         if (!hasQuotes)
+            fStringEvtValues[colIndex][slot].assign(valBegin, valEnd);
          break;
       }
       }
-      colIndex++;
+      if (!ok) {
+         std::string msg = "Could not parse value \"";
+         msg += std::string(valBegin, valEnd) + "\" of column \"" + fHeaders[colIndex] + "\" in entry ";
+         msg += std::to_string(entry) + " of the CSV file as " + fgColTypeMap.at(colType);
+         throw std::runtime_error(msg);
+      }
+
+      pos = fieldEnd < end ? fieldEnd + 1 : end;
+      ++colIndex;
    }
+}
+
+bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   auto &cursor = fSlotCursors[slot * ROOT::Internal::RDF::CacheLineStep<RSlotCursor>()];
+   if (cursor.fChunk >= fChunks.size() || entry < cursor.fNextEntry || entry >= fChunks[cursor.fChunk].fEndEntry)
+      MoveCursor(cursor, entry);
+
+   // Entries are normally requested in order, in which case the line of the entry is the next one
+   const auto &chunk = fChunks[cursor.fChunk];
+   const char *lineBegin = nullptr;
+   const char *lineEnd = nullptr;
+   do {
+      FindLine(fBatch.data(), cursor.fPos, chunk.fEnd, lineBegin, lineEnd);
+   } while (cursor.fNextEntry++ < entry);
+
+   ParseLine(slot, lineBegin, lineEnd, entry);
    return true;
 }
 
@@ -465,6 +608,8 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
    fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
    fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+
+   fSlotCursors.resize(fNSlots * ROOT::Internal::RDF::CacheLineStep<RSlotCursor>());
 }
 
 std::string RCsvDS::GetLabel()
@@ -9,6 +9,20 @@
  *************************************************************************/
 
 #include "ROOT/RDF/ActionHelpers.hxx"
+#include "RConfigure.h" // R__USE_IMT
+#include "TROOT.h"      // IsImplicitMTEnabled
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#ifdef R__HAS_ROOT7
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleMerger.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RPageStorage.hxx"
+#include "ROOT/RPageStorageFile.hxx"
+#include "TSystem.h"
+#endif
 
 namespace ROOT {
 namespace Internal {
@@ -129,6 +143,77 @@ template void FillHelper::Exec(unsigned int, const std::vector<unsigned int> &,
 // template void MaxHelper::Exec(unsigned int, const std::vector<int> &);
 // template void MaxHelper::Exec(unsigned int, const std::vector<unsigned int> &);
 
+void FillTH1DBulk(::TH1D &h, std::size_t n, const double *xs, const double *ws)
+{
+   auto &axis = *h.GetXaxis();
+   const bool isFast = h.IsA() == ::TH1D::Class() && !h.GetBuffer() && axis.GetXbins()->GetSize() == 0 &&
+                       !axis.CanExtend() && !axis.IsAlphanumeric() && !axis.TestBit(TAxis::kAxisRange);
+   if (!isFast) {
+      for (std::size_t i = 0; i < n; ++i)
+         h.Fill(xs[i], ws ? ws[i] : 1.);
+      return;
+   }
+
+   // as in TH1::Fill, a weight different from 1 triggers the storage of the sum of squares of the weights
+   if (ws && h.GetSumw2N() == 0 && !h.TestBit(TH1::kIsNotW) &&
+       std::any_of(ws, ws + n, [](double w) { return w != 1.; }))
+      h.Sumw2();
+
+   const int nBins = axis.GetNbins();
+   const double xMin = axis.GetXmin();
+   const double xMax = axis.GetXmax();
+   double *contents = h.GetArray();
+   double *sumw2 = h.GetSumw2N() > 0 ? h.GetSumw2()->GetArray() : nullptr;
+   double stats[TH1::kNstat];
+   h.GetStats(stats);
+   std::size_t nInRange = 0;
+   for (std::size_t i = 0; i < n; ++i) {
+      const double x = xs[i];
+      // NaN is out of range, as in TAxis::FindBin
+      if (!(x >= xMin && x < xMax))
+         continue;
+      const double w = ws ? ws[i] : 1.;
+      // same bin computation as TAxis::FindBin
+      const int bin = 1 + int(nBins * (x - xMin) / (xMax - xMin));
+      contents[bin] += w;
+      if (sumw2)
+         sumw2[bin] += w * w;
+      stats[0] += w;
+      stats[1] += w * w;
+      stats[2] += w * x;
+      stats[3] += w * x * x;
+      ++nInRange;
+   }
+   h.SetEntries(h.GetEntries() + nInRange);
+   h.PutStats(stats);
+
+   // underflows and overflows are rare, and whether they enter the statistics depends on the histogram settings
+   if (nInRange < n) {
+      for (std::size_t i = 0; i < n; ++i) {
+         if (!(xs[i] >= xMin && xs[i] < xMax))
+            h.Fill(xs[i], ws ? ws[i] : 1.);
+      }
+   }
+}
+
+void TreeReduce(std::size_t n, const std::function<void(std::size_t, std::size_t)> &mergeInto)
+{
+   for (std::size_t stride = 1; stride < n; stride *= 2) {
+      std::vector<std::size_t> targets;
+      for (std::size_t i = 0; i + stride < n; i += 2 * stride)
+         targets.emplace_back(i);
+      auto merge = [&](std::size_t i) { mergeInto(i, i + stride); };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && targets.size() > 1) {
+         ROOT::TThreadExecutor{}.Foreach(merge, targets);
+         continue;
+      }
+#endif
+      for (auto i : targets)
+         merge(i);
+   }
+}
+
 MeanHelper::MeanHelper(const std::shared_ptr<double> &meanVPtr, const unsigned int nSlots)
    : fResultMean(meanVPtr), fCounts(nSlots, 0), fSums(nSlots, 0), fPartialMeans(nSlots)
 {
@@ -264,6 +349,134 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+
+namespace {
+ROOT::Experimental::RNTupleWriteOptions GetNTupleWriteOptions(const RSnapshotOptions &options)
+{
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   // Negative values of fAutoFlush denote a number of bytes for TTrees; RNTuple clusters are sized in entries only
+   if (options.fAutoFlush > 0)
+      writeOptions.SetNEntriesPerCluster(options.fAutoFlush);
+   return writeOptions;
+}
+} // anonymous namespace
+
+SnapshotRNTupleWriters::SnapshotRNTupleWriters(unsigned int nSlots, const std::string &fileName,
+                                               const std::string &dirName, const std::string &ntupleName,
+                                               const RSnapshotOptions &options)
+   : fFileName(fileName), fNTupleName(ntupleName), fOptions(options), fModels(nSlots),
+     fFields(nSlots), fWriters(nSlots), fEntries(nSlots), fEntryAddresses(nSlots)
+{
+   if (!dirName.empty())
+      throw std::invalid_argument("Snapshot: RNTuple output cannot be written into the TFile directory \"" + dirName +
+                                  "\"");
+   ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+}
+
+SnapshotRNTupleWriters::~SnapshotRNTupleWriters() = default;
+
+std::string SnapshotRNTupleWriters::GetSlotFileName(unsigned int slot) const
+{
+   return fFileName + ".snapshot_slot" + std::to_string(slot);
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSink> SnapshotRNTupleWriters::MakeOutputSink()
+{
+   const auto writeOptions = GetNTupleWriteOptions(fOptions);
+   TString fileMode = fOptions.fMode;
+   fileMode.ToLower();
+   if (fileMode != "update")
+      return ROOT::Experimental::Detail::RPageSink::Create(fNTupleName, fFileName, writeOptions);
+
+   fOutputFile.reset(TFile::Open(fFileName.c_str(), "UPDATE"));
+   if (!fOutputFile || fOutputFile->IsZombie())
+      throw std::runtime_error("Snapshot: could not open output file " + fFileName);
+   return std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(fNTupleName, *fOutputFile, writeOptions);
+}
+
+void SnapshotRNTupleWriters::Initialize(std::unique_ptr<ROOT::Experimental::RNTupleModel> model)
+{
+   // Clone the models upfront so that slots initialized concurrently do not touch shared state
+   for (auto &slotModel : fModels)
+      slotModel = model->Clone();
+}
+
+void SnapshotRNTupleWriters::InitSlot(unsigned int slot)
+{
+   if (fWriters[slot])
+      return;
+
+   auto &model = fModels[slot];
+   // The fields stay where they are when the model is moved into the writer
+   fFields[slot] = model->GetFieldZero()->GetSubFields();
+   if (fWriters.size() == 1) {
+      fWriters[slot] = std::make_unique<ROOT::Experimental::RNTupleWriter>(std::move(model), MakeOutputSink());
+   } else {
+      fWriters[slot] = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), fNTupleName,
+                                                                   GetSlotFileName(slot),
+                                                                   GetNTupleWriteOptions(fOptions));
+   }
+}
+
+void SnapshotRNTupleWriters::Fill(unsigned int slot, void *const *addresses)
+{
+   auto &entry = fEntries[slot];
+   auto &entryAddresses = fEntryAddresses[slot];
+   const auto &fields = fFields[slot];
+   if (!entry || !std::equal(entryAddresses.begin(), entryAddresses.end(), addresses)) {
+      entry = std::make_unique<ROOT::Experimental::REntry>();
+      for (std::size_t i = 0; i < fields.size(); ++i)
+         entry->CaptureValue(fields[i]->CaptureValue(addresses[i]));
+      entryAddresses.assign(addresses, addresses + fields.size());
+   }
+   fWriters[slot]->Fill(*entry);
+}
+
+void SnapshotRNTupleWriters::Finalize()
+{
+   fEntries.clear();
+
+   if (fWriters.size() == 1) {
+      // Even if no entry has been processed, an empty ntuple is written
+      InitSlot(0);
+      fWriters[0].reset();
+   } else {
+      std::vector<std::string> slotFileNames;
+      for (unsigned int slot = 0; slot < fWriters.size(); ++slot) {
+         if (!fWriters[slot])
+            continue;
+         fWriters[slot].reset();
+         slotFileNames.emplace_back(GetSlotFileName(slot));
+      }
+
+      if (slotFileNames.empty()) {
+         Warning("Snapshot", "No input entries (input TTree was empty or no entry passed the Filters). Output "
+                             "RNTuple is empty.");
+         ROOT::Experimental::RNTupleWriter emptyWriter(std::move(fModels[0]), MakeOutputSink());
+      } else {
+         std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> sources;
+         std::vector<ROOT::Experimental::Detail::RPageSource *> sourcePtrs;
+         for (const auto &slotFileName : slotFileNames) {
+            sources.emplace_back(ROOT::Experimental::Detail::RPageSource::Create(fNTupleName, slotFileName));
+            sourcePtrs.emplace_back(sources.back().get());
+         }
+         {
+            auto sink = MakeOutputSink();
+            ROOT::Experimental::RNTupleMerger().Merge(sourcePtrs, *sink);
+         }
+         sources.clear();
+         for (const auto &slotFileName : slotFileNames)
+            gSystem->Unlink(slotFileName.c_str());
+      }
+   }
+   fModels.clear();
+   fOutputFile.reset();
+}
+
+#endif // R__HAS_ROOT7
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -27,8 +27,9 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(std::shared_ptr<GraphNode> le
 
    // Explore the graph bottom-up and store its dot representation.
    while (leaf) {
-      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName << "\", style=\"filled\", fillcolor=\""
-                      << leaf->fColor << "\", shape=\"" << leaf->fShape << "\"];\n";
+      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->GetLabel()
+                      << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape
+                      << "\"];\n";
       if (leaf->fPrevNode) {
          dotStringGraph << "\t" << leaf->fPrevNode->fCounter << " -> " << leaf->fCounter << ";\n";
       }
@@ -47,7 +48,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
 
    for (auto leaf : leaves) {
       while (leaf && !leaf->fIsExplored) {
-         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName
+         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->GetLabel()
                          << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape
                          << "\"];\n";
          if (leaf->fPrevNode) {
@@ -100,6 +101,7 @@ CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RDefine
 
    auto node = std::make_shared<GraphNode>("Define\n" + columnName);
    node->SetDefine();
+   node->SetProfile(columnPtr->GetProfile());
 
    sColumnsMap[columnPtr] = node;
    return node;
@@ -120,6 +122,7 @@ std::shared_ptr<GraphNode> CreateFilterNode(const ROOT::Detail::RDF::RFilterBase
 
    sFiltersMap[filterPtr] = node;
    node->SetFilter();
+   node->SetProfile(filterPtr->GetProfile());
    return node;
 }
 
@@ -10,6 +10,7 @@
 
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/InternalTreeUtils.hxx> // GetFileNamesFromTree, GetFriendInfo
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
@@ -19,9 +20,11 @@
 #include <TClassEdit.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -573,6 +576,106 @@ ParsedTreePath ParseTreePath(std::string_view fullTreeName)
    return {std::string(treeName), std::string(dirName)};
 }
 
+/// Write the names of the given files to `key`, and the sizes and modification times of the local ones.
+static void AddFilesToCacheKey(const std::vector<std::string> &fileNames, std::ostream &key)
+{
+   for (const auto &fileName : fileNames) {
+      key << "file: " << fileName;
+      FileStat_t stat;
+      const bool isRemote = fileName.find("://") != std::string::npos && fileName.compare(0, 7, "file://") != 0;
+      if (!isRemote && gSystem->GetPathInfo(fileName.c_str(), stat) == 0)
+         key << ' ' << stat.fSize << ' ' << stat.fMtime;
+      key << '\n';
+   }
+}
+
+/// Return the path of the file of the persistent cache for a Cache() call on the given node, with the given defined
+/// columns, see RInterface::SetCacheDirectory. Only the Defines, Filters and Ranges upstream of the node are part of
+/// the key. Return an empty string if the persistent cache is disabled or if the input dataset cannot be identified,
+/// i.e. for data sources and in-memory trees, or if a column name contains a dot.
+std::string GetPersistentCachePath(RLoopManager &lm, RNodeBase &node, const ColumnNames_t &columns,
+                                   const RBookedDefines &defines)
+{
+   if (lm.GetCacheDirectory().empty() || lm.GetDataSource() != nullptr)
+      return "";
+   // Snapshot would write these columns with a different name
+   for (const auto &column : columns) {
+      if (column.find('.') != std::string::npos)
+         return "";
+   }
+
+   std::stringstream key;
+   key << "RDataFrame persistent cache v1\n" << lm.GetCacheVersion() << '\n';
+   if (auto tree = lm.GetTree()) {
+      try {
+         key << "tree: " << ROOT::Internal::TreeUtils::GetTreeFullPaths(*tree)[0] << '\n';
+         AddFilesToCacheKey(ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree), key);
+         const auto friendInfo = ROOT::Internal::TreeUtils::GetFriendInfo(*tree);
+         for (auto i = 0u; i < friendInfo.fFriendNames.size(); ++i) {
+            key << "friend: " << friendInfo.fFriendNames[i].first << ' ' << friendInfo.fFriendNames[i].second << '\n';
+            AddFilesToCacheKey(friendInfo.fFriendFileNames[i], key);
+         }
+      } catch (const std::runtime_error &) {
+         // not stored in files
+         return "";
+      }
+   } else {
+      key << "entries: " << lm.GetNEmptyEntries() << '\n';
+   }
+
+   for (const auto &column : columns)
+      key << "column: " << column << '\n';
+   auto sortedDefines = defines.GetNames();
+   std::sort(sortedDefines.begin(), sortedDefines.end());
+   for (const auto &define : sortedDefines) {
+      key << "define: " << define;
+      const auto it = defines.GetColumns().find(define);
+      if (it != defines.GetColumns().end()) {
+         if (auto jittedDefine = dynamic_cast<RJittedDefine *>(it->second.get()))
+            key << ' ' << jittedDefine->GetExpression();
+      }
+      key << '\n';
+   }
+   std::vector<std::string> upstreamKeys;
+   node.AddCacheKeys(upstreamKeys);
+   for (const auto &upstreamKey : upstreamKeys)
+      key << upstreamKey << '\n';
+   key << "call: " << lm.GetNCacheCalls() << '\n';
+
+   const auto keyStr = key.str();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyStr.data()), keyStr.size());
+   md5.Final();
+   return lm.GetCacheDirectory() + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+bool HasPersistentCacheFile(const std::string &path)
+{
+   return !gSystem->AccessPathName(path.c_str());
+}
+
+/// Create the directory of the persistent cache if needed and return the path of a temporary file for the cache entry
+/// `path`. The entry is written to the temporary file first, so that concurrent jobs never read partial entries.
+std::string MakePersistentCacheTmpPath(const RLoopManager &lm, const std::string &path)
+{
+   gSystem->mkdir(lm.GetCacheDirectory().c_str(), /*recursive=*/true);
+   return path + ".tmp" + std::to_string(gSystem->GetPid());
+}
+
+/// Move the temporary file of a cache entry in place. Throws, after removing the temporary file, on failure.
+void CommitPersistentCacheFile(const std::string &tmpPath, const std::string &path)
+{
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      RemovePersistentCacheTmpFile(tmpPath);
+      throw std::runtime_error("Cache: could not write the persistent cache file \"" + path + "\".");
+   }
+}
+
+void RemovePersistentCacheTmpFile(const std::string &tmpPath)
+{
+   gSystem->Unlink(tmpPath.c_str());
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -597,6 +700,8 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   jittedFilter->SetExpression(*prevNodeOnHeap, expression);
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedDefines *definesOnHeap = new ROOT::Internal::RDF::RBookedDefines(customCols);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -645,7 +750,8 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
 
    auto definesCopy = new RBookedDefines(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
-   auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs());
+   auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs(),
+                                                                  lm.GetProfilingFlag(), expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", new const char*["
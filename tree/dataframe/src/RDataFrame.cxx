@@ -84,6 +84,7 @@ Transformations are a way to manipulate the data.
 | DefineSlotEntry() | Same as DefineSlot(), but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | Filter() | Filter rows based on user-defined conditions. |
 | Range() | Filter rows based on entry number (single-thread only). |
+| Vary() | Register systematic variations of an existing column. The varied results are produced by ROOT::RDF::Experimental::VariationsFor(). |
 
 ### Actions
 Actions aggregate data into a result. Each one is described in more detail in the reference guide.
@@ -720,6 +721,24 @@ first parameter is the slot number which ranges from 0 to ROOT::GetThreadPoolSiz
 - `DefineSlotEntry(name, f, columnList)`. In this case the callable f has this signature `R(unsigned int, ULong64_t,
 T1, T2, ...)`: the first parameter is the slot number while the second one the number of the entry being processed.
 
+\anchor systematics
+### Systematic variations
+Vary() registers a set of varied values for an existing column, computed by a callable that returns an RVec with one
+element per variation tag. The nominal results are not affected. ROOT::RDF::Experimental::VariationsFor() then books,
+for an action downstream, one result per variation tag that affects its inputs, through Filters and Defines too:
+
+~~~{.cpp}
+auto nominal = df.Vary("pt", [](double pt) { return RVec<double>{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+                 .Filter("pt > 10")
+                 .Histo1D<double>("pt");
+auto hs = ROOT::RDF::Experimental::VariationsFor(nominal);
+hs["nominal"]->Draw();
+hs["pt:up"]->Draw("SAME");
+~~~
+
+All results are produced in the same event loop. Varied results do not support callbacks, and actions downstream of a
+Range that depends on a varied column cannot be varied.
+
 \anchor actions
 ## Actions
 ### Instant and lazy actions
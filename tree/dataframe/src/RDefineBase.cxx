@@ -28,10 +28,13 @@ unsigned int RDefineBase::GetNextID()
 
 RDefineBase::RDefineBase(std::string_view name, std::string_view type, unsigned int nSlots,
                          const RDFInternal::RBookedDefines &defines,
-                         const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
+                         const std::map<std::string, std::vector<void *>> &DSValuePtrs, const bool &isProfiling,
+                         ROOT::RDF::RDataSource *ds)
    : fName(name), fType(type), fNSlots(nSlots),
-     fLastCheckedEntry(fNSlots * RDFInternal::CacheLineStep<Long64_t>(), -1), fDefines(defines),
-     fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs), fDataSource(ds)
+     fLastCheckedEntry(fNSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
+     fLastCheckedVariation(fNSlots * RDFInternal::CacheLineStep<unsigned int>(), 0), fDefines(defines),
+     fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs), fIsProfiling(isProfiling), fDataSource(ds),
+     fProfile(nSlots)
 {
 }
 
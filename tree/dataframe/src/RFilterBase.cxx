@@ -11,7 +11,8 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/Utils.hxx"
-#include <numeric> // std::accumulate
+#include <algorithm> // std::fill
+#include <numeric>   // std::accumulate
 
 using namespace ROOT::Detail::RDF;
 
@@ -19,7 +20,11 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
                          const RDFInternal::RBookedDefines &defines)
    : RNodeBase(implPtr), fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fNSlots(nSlots), fDefines(defines)
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
+     fLastCheckedVariedEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
+     fLastCheckedVariation(nSlots * RDFInternal::CacheLineStep<unsigned int>(), 0),
+     fLastVariedResult(nSlots * RDFInternal::CacheLineStep<int>()), fName(name), fNSlots(nSlots), fDefines(defines),
+     fProfile(nSlots)
 {
 }
 
@@ -48,6 +53,7 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
 void RFilterBase::InitNode()
 {
    fLastCheckedEntry = std::vector<Long64_t>(fNSlots * RDFInternal::CacheLineStep<Long64_t>(), -1);
+   std::fill(fLastCheckedVariedEntry.begin(), fLastCheckedVariedEntry.end(), -1);
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
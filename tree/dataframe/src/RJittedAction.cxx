@@ -93,3 +93,39 @@ std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> RJittedAction::GetMergea
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetMergeableValue();
 }
+
+const std::type_info *RJittedAction::GetMergeableValueType() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetMergeableValueType();
+}
+
+void RJittedAction::SetFromMergeableValue(const ROOT::Detail::RDF::RMergeableValueBase &value)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SetFromMergeableValue(value);
+}
+
+ROOT::Internal::RDF::RVariationKeys RJittedAction::GetVariationKeys()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariationKeys();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase> RJittedAction::MakeVariedAction(std::vector<void *> &&results)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(std::move(results));
+}
+
+std::string RJittedAction::GetActionName()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
+const ROOT::Internal::RDF::RNodeProfile &RJittedAction::GetProfile() const
+{
+   // the action might have never been jitted, in which case it never ran
+   return fConcreteAction ? fConcreteAction->GetProfile() : fProfile;
+}
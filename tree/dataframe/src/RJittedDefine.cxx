@@ -42,3 +42,15 @@ void RJittedDefine::FinaliseSlot(unsigned int slot)
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+const ROOT::Internal::RDF::RVariationKeys &RJittedDefine::GetVariationKeys()
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariationKeys();
+}
+
+const ROOT::Internal::RDF::RNodeProfile &RJittedDefine::GetProfile() const
+{
+   // the define might have never been jitted, in which case it was never evaluated
+   return fConcreteDefine ? fConcreteDefine->GetProfile() : fProfile;
+}
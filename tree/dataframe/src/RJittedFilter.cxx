@@ -35,6 +35,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const ROOT::Internal::RDF::RVariationKeys &RJittedFilter::GetVariationKeys()
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariationKeys();
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -104,6 +110,13 @@ void RJittedFilter::AddFilterName(std::vector<std::string> &filters)
    fConcreteFilter->AddFilterName(filters);
 }
 
+void RJittedFilter::AddCacheKeys(std::vector<std::string> &keys)
+{
+   if (auto prevNode = fPrevNode.lock())
+      prevNode->AddCacheKeys(keys);
+   keys.push_back("filter: " + (HasName() ? GetName() : "Unnamed Filter") + ' ' + fExpression);
+}
+
 std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
 {
    if (fConcreteFilter != nullptr) {
@@ -112,3 +125,15 @@ std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
+
+const ROOT::Internal::RDF::RBookedDefines &RJittedFilter::GetDefines() const
+{
+   // the defines are only known once the concrete filter has been jitted
+   return fConcreteFilter ? fConcreteFilter->GetDefines() : fDefines;
+}
+
+const ROOT::Internal::RDF::RNodeProfile &RJittedFilter::GetProfile() const
+{
+   // the filter might have never been jitted, in which case it was never evaluated
+   return fConcreteFilter ? fConcreteFilter->GetProfile() : fProfile;
+}
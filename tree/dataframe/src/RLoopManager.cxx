@@ -7,34 +7,51 @@
  *************************************************************************/
 
 #include "RConfigure.h" // R__USE_IMT
+#include "ROOT/InternalTreeUtils.hxx"
+#include "ROOT/RConfig.hxx" // R__WIN32
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMergeableValue.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
+#include "ROOT/TSeq.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
+#include "TBufferFile.h"
 #include "TChain.h"
+#include "TClass.h"
 #include "TEntryList.h"
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TInterpreter.h"
 #include "TROOT.h" // IsImplicitMTEnabled
+#include "TTimeStamp.h"
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
+#include "TVirtualPerfStats.h"
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 #endif
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <exception>
 #include <functional>
 #include <iostream>
@@ -292,8 +309,243 @@ DatasetLogInfo TreeDatasetLogInfo(const TTreeReader &r, unsigned int slot)
    return {std::move(what), static_cast<ULong64_t>(entryRange.first), end, slot};
 }
 
+/// Records the file reads and the decompression of TTree baskets performed by the thread it is installed in as
+/// gPerfStats. RLoopProfiler installs one per slot for the duration of the tasks of that slot. All events are also
+/// forwarded to the gPerfStats that was installed before, if any, so that e.g. a TTreePerfStats of the user keeps
+/// recording the reads of the event loop.
+class RSlotPerfStats final : public TVirtualPerfStats {
+   RSlotProfile &fProfile;
+   TVirtualPerfStats *fPrev = nullptr; ///< The gPerfStats replaced by this object, not owned
+
+   // private in TVirtualPerfStats, it cannot be forwarded
+   void SetFile(TFile *) final {}
+
+public:
+   explicit RSlotPerfStats(RSlotProfile &profile) : fProfile(profile) {}
+
+   void SetPrevious(TVirtualPerfStats *prev) { fPrev = prev; }
+
+   void FileReadEvent(TFile *file, Int_t len, Double_t start) final
+   {
+      fProfile.fBytesRead += len;
+      ++fProfile.fReadCalls;
+      fProfile.fReadTime += double(TTimeStamp()) - start;
+      if (fPrev)
+         fPrev->FileReadEvent(file, len, start);
+   }
+
+   void UnzipEvent(TObject *tree, Long64_t pos, Double_t start, Int_t complen, Int_t objlen) final
+   {
+      fProfile.fUnzippedBytes += objlen;
+      fProfile.fUnzipTime += double(TTimeStamp()) - start;
+      if (fPrev)
+         fPrev->UnzipEvent(tree, pos, start, complen, objlen);
+   }
+
+   // the remaining events are not relevant for RDataFrame, they are only forwarded
+   void SimpleEvent(EEventType type) final
+   {
+      if (fPrev)
+         fPrev->SimpleEvent(type);
+   }
+   void PacketEvent(const char *slave, const char *slavename, const char *filename, Long64_t eventsprocessed,
+                    Double_t latency, Double_t proctime, Double_t cputime, Long64_t bytesRead) final
+   {
+      if (fPrev)
+         fPrev->PacketEvent(slave, slavename, filename, eventsprocessed, latency, proctime, cputime, bytesRead);
+   }
+   void FileEvent(const char *slave, const char *slavename, const char *nodename, const char *filename,
+                  Bool_t isStart) final
+   {
+      if (fPrev)
+         fPrev->FileEvent(slave, slavename, nodename, filename, isStart);
+   }
+   void FileOpenEvent(TFile *file, const char *filename, Double_t start) final
+   {
+      if (fPrev)
+         fPrev->FileOpenEvent(file, filename, start);
+   }
+   void RateEvent(Double_t proctime, Double_t deltatime, Long64_t eventsprocessed, Long64_t bytesRead) final
+   {
+      if (fPrev)
+         fPrev->RateEvent(proctime, deltatime, eventsprocessed, bytesRead);
+   }
+   void SetBytesRead(Long64_t num) final
+   {
+      if (fPrev)
+         fPrev->SetBytesRead(num);
+   }
+   Long64_t GetBytesRead() const final { return fProfile.fBytesRead; }
+   void SetNumEvents(Long64_t num) final
+   {
+      if (fPrev)
+         fPrev->SetNumEvents(num);
+   }
+   Long64_t GetNumEvents() const final { return fProfile.fNEntries; }
+   void PrintBasketInfo(Option_t *option = "") const final
+   {
+      if (fPrev)
+         fPrev->PrintBasketInfo(option);
+   }
+   void SetLoaded(TBranch *b, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetLoaded(b, basketNumber);
+   }
+   void SetLoaded(size_t bi, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetLoaded(bi, basketNumber);
+   }
+   void SetLoadedMiss(TBranch *b, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetLoadedMiss(b, basketNumber);
+   }
+   void SetLoadedMiss(size_t bi, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetLoadedMiss(bi, basketNumber);
+   }
+   void SetMissed(TBranch *b, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetMissed(b, basketNumber);
+   }
+   void SetMissed(size_t bi, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetMissed(bi, basketNumber);
+   }
+   void SetUsed(TBranch *b, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetUsed(b, basketNumber);
+   }
+   void SetUsed(size_t bi, size_t basketNumber) final
+   {
+      if (fPrev)
+         fPrev->SetUsed(bi, basketNumber);
+   }
+   void UpdateBranchIndices(TObjArray *branches) final
+   {
+      if (fPrev)
+         fPrev->UpdateBranchIndices(branches);
+   }
+};
+
+/// A chain equivalent to a TTree or TChain stored in files, with its friends and entry list, that opens the files
+/// again. The worker processes of multi-process event loops read through it: the file descriptors they inherit share
+/// their offsets, so reading through them from several processes at once would return corrupted data.
+struct RWorkerChain {
+   // NOTE: fFriends and fEntryList must be deleted after fChain, which does not deregister from them at destruction
+   std::vector<std::unique_ptr<TChain>> fFriends;
+   std::unique_ptr<TEntryList> fEntryList;
+   std::unique_ptr<TChain> fChain;
+
+   explicit RWorkerChain(TTree &tree)
+   {
+      const auto fileNames = ROOT::Internal::TreeUtils::GetFileNamesFromTree(tree);
+      const auto treeNames = ROOT::Internal::TreeUtils::GetTreeFullPaths(tree);
+      fChain = std::make_unique<TChain>();
+      for (auto i : ROOT::TSeqUL(fileNames.size()))
+         fChain->Add((fileNames[i] + "/" + treeNames[i]).c_str());
+      fChain->ResetBit(TObject::kMustCleanup);
+
+      const auto friendInfo = ROOT::Internal::TreeUtils::GetFriendInfo(tree);
+      for (auto i : ROOT::TSeqUL(friendInfo.fFriendNames.size())) {
+         const auto &friendFileNames = friendInfo.fFriendFileNames[i];
+         const auto &friendSubNames = friendInfo.fFriendChainSubNames[i];
+         auto friendChain = std::make_unique<TChain>(friendInfo.fFriendNames[i].first.c_str());
+         // a friend without sub-names is a TTree, its file names can be added directly
+         for (auto j : ROOT::TSeqUL(friendFileNames.size()))
+            friendChain->Add(friendSubNames.empty() ? friendFileNames[j].c_str()
+                                                    : (friendFileNames[j] + "/" + friendSubNames[j]).c_str());
+         fChain->AddFriend(friendChain.get(), friendInfo.fFriendNames[i].second.c_str());
+         fFriends.emplace_back(std::move(friendChain));
+      }
+
+      if (const auto entryList = tree.GetEntryList()) {
+         fEntryList = std::make_unique<TEntryList>(*entryList);
+         if (fEntryList->GetLists() != nullptr) {
+            // the chain sets the tree numbers of the sub-lists, but we retain ownership
+            fChain->SetEntryList(fEntryList.get());
+            fEntryList->ResetBit(TObject::kCanDelete);
+         }
+      }
+   }
+};
+
 } // anonymous namespace
 
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The profiling information of RLoopManager that is not specific to a node: per-slot task timings and I/O counters,
+/// timings of the whole event loops.
+class RLoopProfiler {
+   using Clock_t = std::chrono::steady_clock;
+
+   struct RSlotState {
+      RSlotProfile fProfile;
+      RSlotPerfStats fPerfStats{fProfile};
+      TVirtualPerfStats *fPrevPerfStats = nullptr; ///< The gPerfStats of the thread before the current task started
+      Clock_t::time_point fTaskStart;
+      bool fIsRunningTask = false;
+   };
+   /// One element per slot. Each state is allocated separately to avoid false sharing between slots.
+   std::vector<std::unique_ptr<RSlotState>> fSlots;
+
+public:
+   unsigned int fNRuns = 0;
+   double fRealTime = 0.;
+   double fCpuTime = 0.;
+
+   explicit RLoopProfiler(unsigned int nSlots)
+   {
+      for (auto i = 0u; i < nSlots; ++i)
+         fSlots.emplace_back(new RSlotState());
+   }
+
+   void StartTask(unsigned int slot)
+   {
+      auto &s = *fSlots[slot];
+      s.fPrevPerfStats = gPerfStats;
+      s.fPerfStats.SetPrevious(s.fPrevPerfStats);
+      gPerfStats = &s.fPerfStats;
+      SetProfilingActive(true);
+      s.fIsRunningTask = true;
+      s.fTaskStart = Clock_t::now();
+   }
+
+   /// Must be called by the thread that called StartTask. Does nothing if the slot is not running a task.
+   void StopTask(unsigned int slot)
+   {
+      auto &s = *fSlots[slot];
+      if (!s.fIsRunningTask)
+         return;
+      s.fProfile.fRealTime += std::chrono::duration<double>(Clock_t::now() - s.fTaskStart).count();
+      s.fIsRunningTask = false;
+      SetProfilingActive(false);
+      gPerfStats = s.fPrevPerfStats;
+   }
+
+   void AddEntry(unsigned int slot) { ++fSlots[slot]->fProfile.fNEntries; }
+
+   std::vector<RSlotProfile> GetSlotProfiles() const
+   {
+      std::vector<RSlotProfile> profiles;
+      for (const auto &s : fSlots)
+         profiles.emplace_back(s->fProfile);
+      return profiles;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Get all the branches names, including the ones of the friend trees
 ColumnNames_t ROOT::Internal::RDF::GetBranchNames(TTree &t, bool allowDuplicates)
@@ -327,6 +579,9 @@ RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t
    fDataSource->SetNSlots(fNSlots);
 }
 
+// outlined because of the incomplete RLoopProfiler type in the header
+RLoopManager::~RLoopManager() {}
+
 struct RSlotRAII {
    RSlotStack &fSlotStack;
    unsigned int fSlot;
@@ -380,13 +635,13 @@ void RLoopManager::RunEmptySourceMT()
 #endif // not implemented otherwise
 }
 
-/// Run event loop with no source files, in sequence.
-void RLoopManager::RunEmptySource()
+/// Run event loop with no source files, in sequence, over the entries in [begin, end).
+void RLoopManager::RunEmptySource(ULong64_t begin, ULong64_t end)
 {
    InitNodeSlots(nullptr, 0);
-   R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", 0, fNEmptyEntries, 0u});
+   R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", begin, end, 0u});
    try {
-      for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
+      for (ULong64_t currEntry = begin; currEntry < end && fNStopsReceived < fNChildren; ++currEntry) {
          RunAndCheckFilters(0, currEntry);
       }
    } catch (...) {
@@ -431,11 +686,14 @@ void RLoopManager::RunTreeProcessorMT()
 }
 
 /// Run event loop over one or multiple ROOT files, in sequence.
-void RLoopManager::RunTreeReader()
+/// A non-negative `end` restricts the event loop to the entries in [begin, end).
+void RLoopManager::RunTreeReader(TTree &tree, TEntryList *entryList, Long64_t begin, Long64_t end)
 {
-   TTreeReader r(fTree.get(), fTree->GetEntryList());
-   if (0 == fTree->GetEntriesFast())
+   TTreeReader r(&tree, entryList);
+   if (0 == tree.GetEntriesFast())
       return;
+   if (end >= 0)
+      r.SetEntriesRange(begin, end);
    InitNodeSlots(&r, 0);
    R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, 0u));
 
@@ -450,7 +708,10 @@ void RLoopManager::RunTreeReader()
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
    }
-   if (r.GetEntryStatus() != TTreeReader::kEntryNotFound && fNStopsReceived < fNChildren) {
+   // with an entry range, the loop ends with kEntryBeyondEnd when the end of the range is reached
+   const auto status = r.GetEntryStatus();
+   const bool isRangeEnd = end >= 0 && status == TTreeReader::kEntryBeyondEnd;
+   if (status != TTreeReader::kEntryNotFound && !isRangeEnd && fNStopsReceived < fNChildren) {
       // something went wrong in the TTreeReader event loop
       throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                std::to_string(r.GetEntryStatus()));
@@ -459,16 +720,20 @@ void RLoopManager::RunTreeReader()
 }
 
 /// Run event loop over data accessed through a DataSource, in sequence.
-void RLoopManager::RunDataSource()
+/// In multi-process event loops, worker `worker` out of `nWorkers` only processes every `nWorkers`-th entry range.
+void RLoopManager::RunDataSource(unsigned int worker, unsigned int nWorkers)
 {
    R__ASSERT(fDataSource != nullptr);
    fDataSource->Initialise();
    auto ranges = fDataSource->GetEntryRanges();
+   ULong64_t rangeIdx = 0ull;
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
       InitNodeSlots(nullptr, 0u);
       fDataSource->InitSlot(0u, 0ull);
       try {
          for (const auto &range : ranges) {
+            if (rangeIdx++ % nWorkers != worker)
+               continue;
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
@@ -532,10 +797,129 @@ void RLoopManager::RunDataSourceMT()
 #endif // not implemented otherwise (never called)
 }
 
+/// Throw if the computation graph cannot run in a multi-process event loop, see RunMultiProcess.
+void RLoopManager::CheckMultiProcess()
+{
+#ifdef R__WIN32
+   throw std::runtime_error("RDataFrame: multi-process event loops are not supported on Windows.");
+#endif
+   if (!fBookedRanges.empty())
+      throw std::logic_error("RDataFrame: Range is not supported in multi-process event loops.");
+   for (auto *action : fBookedActions) {
+      const auto *valueType = action->GetMergeableValueType();
+      if (!valueType)
+         throw std::logic_error("RDataFrame: the results of " + action->GetActionName() +
+                                " cannot be merged, it cannot run in a multi-process event loop.");
+      // the worker processes send the mergeables to this one through their dictionaries
+      const auto valueClass = TClass::GetClass(*valueType);
+      if (!valueClass || !valueClass->HasDictionary())
+         throw std::runtime_error("RDataFrame: the results of " + action->GetActionName() +
+                                  " cannot run in a multi-process event loop, there is no dictionary for " +
+                                  ROOT::Internal::GetDemangledTypeName(*valueType) + ".");
+   }
+}
+
+/// Run the event loop in fNProcesses worker processes forked from this one. Each worker runs the event loop in
+/// sequence on its part of the dataset and sends back the results of the booked actions, see RunWorker.
+/// \return The results of the booked actions merged over the workers, in the order of fBookedActions.
+std::vector<std::unique_ptr<RMergeableValueBase>> RLoopManager::RunMultiProcess()
+{
+   std::vector<std::unique_ptr<RMergeableValueBase>> mergedValues(fBookedActions.size());
+#ifndef R__WIN32
+   const auto nWorkers = fNProcesses;
+
+   // Split the entries evenly among the workers. Data sources are split by entry range instead, see RunDataSource.
+   // With an entry list, the ranges are indices in the entry list, as TTreeReader::SetEntriesRange expects.
+   ULong64_t nEntries = 0ull;
+   if (fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT) {
+      nEntries = fNEmptyEntries;
+   } else if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
+      const auto entryList = fTree->GetEntryList();
+      nEntries = entryList ? entryList->GetN() : fTree->GetEntries();
+   }
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (auto worker : ROOT::TSeqU(nWorkers))
+      ranges.emplace_back(nEntries * worker / nWorkers, nEntries * (worker + 1) / nWorkers);
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   auto runWorker = [this, &ranges](unsigned int worker) { return RunWorker(worker, ranges[worker]); };
+   const auto results = pool.Map(runWorker, ROOT::TSeqU(nWorkers));
+   if (results.size() != nWorkers)
+      throw std::runtime_error("RDataFrame: could not run the worker processes of the event loop.");
+
+   const auto baseClass = TClass::GetClass<RMergeableValueBase>();
+   for (const auto &result : results) {
+      if (result.empty() || result[0] != 'R')
+         throw std::runtime_error("RDataFrame: a worker process of the event loop failed: " +
+                                  (result.empty() ? std::string("no result received") : result.substr(1)));
+      TBufferFile buf(TBuffer::kRead, result.size() - 1, const_cast<char *>(result.data()) + 1, /*adopt=*/false);
+      for (auto &mergedValue : mergedValues) {
+         std::unique_ptr<RMergeableValueBase> value(static_cast<RMergeableValueBase *>(buf.ReadObjectAny(baseClass)));
+         if (!value)
+            throw std::runtime_error("RDataFrame: could not read the results of a worker process.");
+         if (mergedValue)
+            mergedValue->MergeAny(*value);
+         else
+            mergedValue = std::move(value);
+      }
+   }
+#endif
+   return mergedValues;
+}
+
+/// Run the part of a multi-process event loop assigned to a worker process, i.e. the entries in `range`, or every
+/// fNProcesses-th entry range of the data source, and serialize the results of the booked actions.
+/// \return 'R' followed by the serialized RMergeableValue of each booked action, or 'E' followed by an error message.
+std::string RLoopManager::RunWorker(unsigned int worker, std::pair<ULong64_t, ULong64_t> range)
+{
+   try {
+      switch (fLoopType) {
+      case ELoopType::kNoFiles:
+      case ELoopType::kNoFilesMT: RunEmptySource(range.first, range.second); break;
+      case ELoopType::kROOTFiles:
+      case ELoopType::kROOTFilesMT:
+         if (range.first == range.second)
+            break;
+         if (dynamic_cast<TChain *>(fTree.get()) || fTree->GetCurrentFile()) {
+            RWorkerChain chain(*fTree);
+            // reading must not use the thread pool of the parent process, its threads do not exist after fork
+            chain.fChain->SetImplicitMT(false);
+            RunTreeReader(*chain.fChain, chain.fEntryList.get(), range.first, range.second);
+         } else {
+            fTree->SetImplicitMT(false);
+            RunTreeReader(*fTree, fTree->GetEntryList(), range.first, range.second);
+         }
+         break;
+      case ELoopType::kDataSource:
+      case ELoopType::kDataSourceMT: RunDataSource(worker, fNProcesses); break;
+      }
+
+      TBufferFile buf(TBuffer::kWrite);
+      for (auto *action : fBookedActions) {
+         action->Finalize();
+         const auto value = action->GetMergeableValue();
+         const auto &valueRef = *value;
+         const auto valueClass = TClass::GetClass(typeid(valueRef));
+         if (!valueClass)
+            throw std::runtime_error("the results of " + action->GetActionName() + " cannot be streamed.");
+         buf.WriteObjectAny(value.get(), valueClass);
+      }
+      std::string result(1, 'R');
+      result.append(buf.Buffer(), buf.Length());
+      return result;
+   } catch (const std::exception &e) {
+      return std::string("E") + e.what();
+   } catch (...) {
+      return "Eunknown exception";
+   }
+}
+
 /// Execute actions and make sure named filters are called for each event.
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fProfiling)
+      fLoopProfiler->AddEntry(slot);
    for (auto &actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
    for (auto &namedFilterPtr : fBookedNamedFilters)
@@ -555,6 +939,9 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
       ptr->InitSlot(r, slot);
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+   // started last, so that the task is always stopped by CleanUpTask if it is started
+   if (fProfiling)
+      fLoopProfiler->StartTask(slot);
 }
 
 /// Initialize all nodes of the functional graph before running the event loop.
@@ -603,6 +990,8 @@ void RLoopManager::CleanUpTask(unsigned int slot)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedFilters)
       ptr->FinaliseSlot(slot);
+   if (fProfiling)
+      fLoopProfiler->StopTask(slot);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -653,21 +1042,47 @@ void RLoopManager::Run()
 
    Jit();
 
+   const bool multiProcess = fNProcesses > 1;
+   if (multiProcess)
+      CheckMultiProcess();
+
    InitNodes();
 
    TStopwatch s;
    s.Start();
-   switch (fLoopType) {
-   case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
-   case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
-   case ELoopType::kNoFiles: RunEmptySource(); break;
-   case ELoopType::kROOTFiles: RunTreeReader(); break;
-   case ELoopType::kDataSource: RunDataSource(); break;
+   std::vector<std::unique_ptr<RMergeableValueBase>> mergedValues;
+   try {
+      if (multiProcess) {
+         mergedValues = RunMultiProcess();
+      } else {
+         switch (fLoopType) {
+         case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
+         case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+         case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
+         case ELoopType::kNoFiles: RunEmptySource(0ull, fNEmptyEntries); break;
+         case ELoopType::kROOTFiles: RunTreeReader(*fTree, fTree->GetEntryList(), 0ll, -1ll); break;
+         case ELoopType::kDataSource: RunDataSource(); break;
+         }
+      }
+   } catch (...) {
+      // RunTreeReader can throw without cleaning up its task: the thread must not keep the slot's gPerfStats
+      if (fProfiling)
+         fLoopProfiler->StopTask(0u);
+      throw;
    }
    s.Stop();
 
+   if (fProfiling) {
+      ++fLoopProfiler->fNRuns;
+      fLoopProfiler->fRealTime += s.RealTime();
+      fLoopProfiler->fCpuTime += s.CpuTime();
+   }
+
+   // the results of multi-process event loops are set after CleanUpNodes, which finalizes (and forgets) the actions
+   const auto actions = fBookedActions;
    CleanUpNodes();
+   for (auto i : ROOT::TSeqUL(mergedValues.size()))
+      actions[i]->SetFromMergeableValue(*mergedValues[i]);
 
    fNRuns++;
 
@@ -792,6 +1207,12 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RLoopManager::GetG
    return thisNode;
 }
 
+const RDFInternal::RVariationKeys &RLoopManager::GetVariationKeys()
+{
+   static const RDFInternal::RVariationKeys noVariations;
+   return noVariations;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// Return all valid TTree::Branch names (caching results for subsequent calls).
 /// Never use fBranchNames directy, always request it through this method.
@@ -812,3 +1233,49 @@ void RLoopManager::AddDSValuePtrs(const std::string &col, const std::vector<void
 {
    fDSValuePtrMap[col] = ptrs;
 }
+
+void RLoopManager::SetProfiling(bool profiling)
+{
+   fProfiling = profiling;
+   if (fProfiling && !fLoopProfiler)
+      fLoopProfiler.reset(new RDFInternal::RLoopProfiler(fNSlots));
+}
+
+/// Return the profiling information of all nodes of the computation graph and of the event loops run so far
+/// with profiling enabled. Triggers jitting, as jitted nodes can only be inspected after it.
+ROOT::RDF::RProfileReport RLoopManager::GetProfileReport()
+{
+   Jit();
+
+   ROOT::RDF::RProfileReport report;
+   if (fLoopProfiler) {
+      report.fSlots = fLoopProfiler->GetSlotProfiles();
+      report.fNRuns = fLoopProfiler->fNRuns;
+      report.fRealTime = fLoopProfiler->fRealTime;
+      report.fCpuTime = fLoopProfiler->fCpuTime;
+   }
+
+   // Defines are shared between branches of the graph and appear in the booked defines of all downstream nodes
+   std::set<const RDefineBase *> seenDefines;
+   auto addDefines = [&report, &seenDefines](const RDFInternal::RBookedDefines &defines) {
+      const auto &columns = defines.GetColumns();
+      for (const auto &name : defines.GetNames()) {
+         const auto it = columns.find(name);
+         if (it == columns.end() || RDFInternal::IsInternalColumn(name))
+            continue; // aliases appear in the list of names but have no node
+         if (seenDefines.insert(it->second.get()).second)
+            report.fNodes.push_back(ROOT::RDF::RNodeProfileInfo("Define", name, it->second->GetProfile()));
+      }
+   };
+   for (auto *filter : fBookedFilters) {
+      addDefines(filter->GetDefines());
+      const auto name = filter->HasName() ? filter->GetName() : "Filter";
+      report.fNodes.push_back(ROOT::RDF::RNodeProfileInfo("Filter", name, filter->GetProfile()));
+   }
+   for (auto *action : GetAllActions()) {
+      addDefines(action->GetDefines());
+      report.fNodes.push_back(ROOT::RDF::RNodeProfileInfo("Action", action->GetActionName(), action->GetProfile()));
+   }
+
+   return report;
+}
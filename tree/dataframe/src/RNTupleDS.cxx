@@ -25,6 +25,8 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -237,13 +239,25 @@ void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName
    fColumnReaderPrototypes.emplace_back(std::move(valColReader));
 }
 
-RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
+RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource, bool attachLazily)
 {
-   pageSource->Attach();
-   const auto &descriptor = pageSource->GetDescriptor();
    fSources.emplace_back(std::move(pageSource));
+   if (!attachLazily)
+      Attach();
+}
 
+void RNTupleDS::Attach()
+{
+   fSources[0]->Attach();
+   const auto &descriptor = fSources[0]->GetDescriptor();
    AddField(descriptor, "", descriptor.GetFieldZeroId(), std::vector<DescriptorId_t>());
+   fIsAttached = true;
+
+   for (unsigned int i = 1; i < fNSlots; ++i) {
+      fSources.emplace_back(fSources[0]->Clone());
+      R__ASSERT(i == (fSources.size() - 1));
+      fSources[i]->Attach();
+   }
 }
 
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
@@ -255,6 +269,7 @@ RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* n
 std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
 RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info & /*tid*/)
 {
+   EnsureAttached();
    // at this point we can assume that `name` will be found in fColumnNames, RDF is in charge validation
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
@@ -268,13 +283,63 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::SelectRange(std::string_view fieldName, double min, double max)
+{
+   EnsureAttached();
+   const auto &descriptor = fSources[0]->GetDescriptor();
+   const auto fieldId = descriptor.FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId)
+      throw std::runtime_error("RNTupleDS: no field named '" + std::string(fieldName) + "'");
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (const auto &r : descriptor.FindEntryRanges(fieldId, min, max))
+      ranges.emplace_back(r.fFirstEntry, r.fFirstEntry + r.fNEntries);
+   if (!fHasSelection) {
+      fSelectedRanges = std::move(ranges);
+      fHasSelection = true;
+      return;
+   }
+
+   // Both lists of ranges are sorted and free of overlaps
+   std::vector<std::pair<ULong64_t, ULong64_t>> intersection;
+   auto itrA = fSelectedRanges.begin();
+   auto itrB = ranges.begin();
+   while (itrA != fSelectedRanges.end() && itrB != ranges.end()) {
+      const auto begin = std::max(itrA->first, itrB->first);
+      const auto end = std::min(itrA->second, itrB->second);
+      if (begin < end)
+         intersection.emplace_back(begin, end);
+      if (itrA->second < itrB->second)
+         ++itrA;
+      else
+         ++itrB;
+   }
+   fSelectedRanges = std::move(intersection);
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
+   EnsureAttached();
    // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (fHasSelection) {
+      // Let the page sources skip the clusters outside of the selected ranges
+      std::vector<RNTupleReadOptions::REntryRange> entryRanges;
+      for (const auto &r : fSelectedRanges) {
+         RNTupleReadOptions::REntryRange entryRange;
+         entryRange.fFirstEntry = r.first;
+         entryRange.fNEntries = r.second - r.first;
+         entryRanges.emplace_back(entryRange);
+      }
+      for (auto &source : fSources)
+         source->SetEntryRanges(entryRanges);
+      fHasSeenAllRanges = true;
+      return fSelectedRanges;
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -293,17 +358,20 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
+   EnsureAttached();
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
    return fColumnTypes[index];
 }
 
 bool RNTupleDS::HasColumn(std::string_view colName) const
 {
+   EnsureAttached();
    return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
 }
 
 void RNTupleDS::Initialise()
 {
+   EnsureAttached();
    fHasSeenAllRanges = false;
 }
 
@@ -314,6 +382,9 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
+   // Otherwise, the sources of the other slots are created once the first source is attached
+   if (!fIsAttached)
+      return;
 
    for (unsigned int i = 1; i < fNSlots; ++i) {
       fSources.emplace_back(fSources[0]->Clone());
@@ -330,3 +401,11 @@ ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntuple
    ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(std::move(pageSource)));
    return rdf;
 }
+
+std::shared_ptr<ROOT::RDataFrame>
+ROOT::Internal::RDF::MakeLazyNTupleDataFrame(std::string_view ntupleName, std::string_view fileName)
+{
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   return std::make_shared<ROOT::RDataFrame>(
+      std::make_unique<ROOT::Experimental::RNTupleDS>(std::move(pageSource), true /* attachLazily */));
+}
@@ -0,0 +1,40 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeProfile.hxx"
+
+namespace {
+/// Whether the task run by this thread is profiled. Only RLoopManager changes it, at the beginning and end of tasks.
+thread_local bool gProfilingActive = false;
+/// Time spent in the inner scopes of the innermost RProfileScope open in this thread.
+thread_local double gChildTime = 0.;
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+bool IsProfilingActive()
+{
+   return gProfilingActive;
+}
+
+void SetProfilingActive(bool active)
+{
+   gProfilingActive = active;
+   gChildTime = 0.;
+}
+
+double &RProfileScope::ChildTime()
+{
+   return gChildTime;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
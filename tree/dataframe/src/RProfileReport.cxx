@@ -0,0 +1,112 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+namespace {
+std::string EscapeJSON(const std::string &s)
+{
+   std::string escaped;
+   for (const char c : s) {
+      switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[7];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+         } else {
+            escaped += c;
+         }
+      }
+   }
+   return escaped;
+}
+} // anonymous namespace
+
+namespace ROOT {
+namespace RDF {
+
+RNodeProfileInfo::RNodeProfileInfo(const std::string &kind, const std::string &name,
+                                   const ROOT::Internal::RDF::RNodeProfile &p)
+   : fKind(kind), fName(name)
+{
+   for (auto slot = 0u; slot < p.GetNSlots(); ++slot)
+      fCounters.emplace_back(p.GetCounters(slot));
+}
+
+ULong64_t RNodeProfileInfo::GetNCalls() const
+{
+   ULong64_t nCalls = 0;
+   for (const auto &c : fCounters)
+      nCalls += c.fNCalls;
+   return nCalls;
+}
+
+double RNodeProfileInfo::GetTime() const
+{
+   double time = 0.;
+   for (const auto &c : fCounters)
+      time += c.fTime;
+   return time;
+}
+
+void RProfileReport::Print() const
+{
+   Printf("Profiled event loops: %u, entries: %llu, wall time: %.3f s, CPU time: %.3f s", fNRuns, GetNEntries(),
+          fRealTime, fCpuTime);
+   Printf("Read: %llu bytes in %llu calls, %.3f s. Decompression: %llu bytes, %.3f s", GetBytesRead(),
+          GetReadCalls(), GetReadTime(), GetUnzippedBytes(), GetUnzipTime());
+
+   std::vector<const RNodeProfileInfo *> nodes;
+   for (const auto &n : fNodes)
+      nodes.emplace_back(&n);
+   std::stable_sort(nodes.begin(), nodes.end(),
+                    [](const RNodeProfileInfo *a, const RNodeProfileInfo *b) { return a->GetTime() > b->GetTime(); });
+   Printf("%-8s %-30s %-14s %s", "Kind", "Name", "Calls", "Time [s]");
+   for (const auto *n : nodes)
+      Printf("%-8s %-30s %-14llu %.6f", n->GetKind().c_str(), n->GetName().c_str(), n->GetNCalls(), n->GetTime());
+}
+
+std::string RProfileReport::AsJSON() const
+{
+   std::ostringstream os;
+   os << "{\n  \"nRuns\": " << fNRuns << ",\n  \"realTime\": " << fRealTime << ",\n  \"cpuTime\": " << fCpuTime
+      << ",\n  \"slots\": [";
+   for (auto i = 0u; i < fSlots.size(); ++i) {
+      const auto &s = fSlots[i];
+      os << (i == 0 ? "\n" : ",\n") << "    {\"entries\": " << s.fNEntries << ", \"realTime\": " << s.fRealTime
+         << ", \"bytesRead\": " << s.fBytesRead << ", \"readCalls\": " << s.fReadCalls
+         << ", \"readTime\": " << s.fReadTime << ", \"unzippedBytes\": " << s.fUnzippedBytes
+         << ", \"unzipTime\": " << s.fUnzipTime << "}";
+   }
+   os << "\n  ],\n  \"nodes\": [";
+   for (auto i = 0u; i < fNodes.size(); ++i) {
+      const auto &n = fNodes[i];
+      os << (i == 0 ? "\n" : ",\n") << "    {\"kind\": \"" << n.GetKind() << "\", \"name\": \""
+         << EscapeJSON(n.GetName()) << "\", \"calls\": " << n.GetNCalls() << ", \"time\": " << n.GetTime()
+         << ", \"slots\": [";
+      for (auto slot = 0u; slot < n.GetNSlots(); ++slot)
+         os << (slot == 0 ? "" : ", ") << "{\"calls\": " << n.GetNCalls(slot) << ", \"time\": " << n.GetTime(slot)
+            << "}";
+      os << "]}";
+   }
+   os << "\n  ]\n}\n";
+   return os.str();
+}
+
+} // namespace RDF
+} // namespace ROOT
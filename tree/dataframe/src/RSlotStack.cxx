@@ -8,30 +8,87 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
-#include <ROOT/TSeq.hxx>
 #include <ROOT/RDF/RSlotStack.hxx>
 #include <TError.h> // R__ASSERT
 
-#include <mutex> // std::lock_guard
+#include <algorithm> // std::min
 
-ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
+namespace {
+
+constexpr unsigned int kBitsPerWord = 64;
+
+/// The slot last returned by the calling thread, tried first by GetSlot. Only a hint: it can be out of range, or
+/// refer to another RSlotStack.
+unsigned int &LastSlot()
+{
+   thread_local unsigned int lastSlot = 0;
+   return lastSlot;
+}
+
+/// Index of the lowest set bit of a non-zero word
+unsigned int LowestBit(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_ctzll(word);
+#else
+   unsigned int bit = 0;
+   while (!(word & 1ull)) {
+      word >>= 1;
+      ++bit;
+   }
+   return bit;
+#endif
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RDF::RSlotStack::RSlotStack(unsigned int size)
+   : fSize(size), fFreeSlots(new std::atomic<std::uint64_t>[(size + kBitsPerWord - 1) / kBitsPerWord]), fNFree(size)
 {
-   for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
+   for (unsigned int w = 0; w < (size + kBitsPerWord - 1) / kBitsPerWord; ++w) {
+      const auto nBits = std::min(kBitsPerWord, size - w * kBitsPerWord);
+      fFreeSlots[w].store(nBits == kBitsPerWord ? ~0ull : (1ull << nBits) - 1ull, std::memory_order_relaxed);
+   }
+}
+
+bool ROOT::Internal::RDF::RSlotStack::TryGetSlot(unsigned int slot)
+{
+   auto &word = fFreeSlots[slot / kBitsPerWord];
+   const auto mask = 1ull << (slot % kBitsPerWord);
+   return (word.load(std::memory_order_relaxed) & mask) && (word.fetch_and(~mask, std::memory_order_acquire) & mask);
 }
 
 void ROOT::Internal::RDF::RSlotStack::ReturnSlot(unsigned int slot)
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   R__ASSERT(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   fStack.push(slot);
+   R__ASSERT(slot < fSize && "Trying to put back a slot that does not exist!");
+   const auto mask = 1ull << (slot % kBitsPerWord);
+   const auto oldWord = fFreeSlots[slot / kBitsPerWord].fetch_or(mask, std::memory_order_release);
+   R__ASSERT(!(oldWord & mask) && "Trying to put back a slot to a full stack!");
+   fNFree.fetch_add(1, std::memory_order_release);
 }
 
 unsigned int ROOT::Internal::RDF::RSlotStack::GetSlot()
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   R__ASSERT(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
-   return slot;
+   const auto nFree = fNFree.fetch_sub(1, std::memory_order_acquire);
+   R__ASSERT(nFree > 0 && "Trying to pop a slot from an empty stack!");
+
+   auto &lastSlot = LastSlot();
+   if (lastSlot < fSize && TryGetSlot(lastSlot))
+      return lastSlot;
+
+   // The decrement above reserved one of the free slots, but its bit might be set by a concurrent ReturnSlot only
+   // after we scanned its word: scan again until we claim it.
+   const auto nWords = (fSize + kBitsPerWord - 1) / kBitsPerWord;
+   while (true) {
+      for (unsigned int w = 0; w < nWords; ++w) {
+         auto word = fFreeSlots[w].load(std::memory_order_relaxed);
+         while (word != 0ull) {
+            if (fFreeSlots[w].compare_exchange_weak(word, word & (word - 1ull), std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+               lastSlot = w * kBitsPerWord + LowestBit(word);
+               return lastSlot;
+            }
+         }
+      }
+   }
 }
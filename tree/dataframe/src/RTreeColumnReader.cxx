@@ -0,0 +1,121 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RTreeColumnReader.hxx"
+
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TDataType.h"
+#include "TLeaf.h"
+#include "TLeafB.h"
+#include "TLeafD.h"
+#include "TLeafF.h"
+#include "TLeafG.h"
+#include "TLeafI.h"
+#include "TLeafL.h"
+#include "TLeafS.h"
+#include "TMath.h"
+#include "TROOT.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+/// Whether the values of the leaf can be read with TLeaf::ReadBasketFast into values of the given type.
+bool IsBulkReadable(TLeaf &leaf, const std::type_info &type)
+{
+   // The leaf types implementing ReadBasketFast for fixed-size values
+   static const TClass *const leafClasses[] = {TLeafB::Class(), TLeafS::Class(), TLeafI::Class(), TLeafL::Class(),
+                                               TLeafG::Class(), TLeafF::Class(), TLeafD::Class()};
+   const auto leafClass = leaf.IsA();
+   if (std::find(std::begin(leafClasses), std::end(leafClasses), leafClass) == std::end(leafClasses))
+      return false;
+   if (leaf.GetLeafCount() || leaf.GetLenStatic() != 1)
+      return false;
+   auto leafType = gROOT->GetType(leaf.GetTypeName());
+   return leafType && leafType->GetType() == TDataType::GetType(type);
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RDF::RTreeBulkColumnReader::RTreeBulkColumnReader(TTreeReader &r, const std::string &colName,
+                                                                  const std::type_info &type, std::size_t size)
+   : fReader(r), fColName(colName), fType(type), fSize(size),
+     fBuffer(std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024))
+{
+}
+
+ROOT::Internal::RDF::RTreeBulkColumnReader::~RTreeBulkColumnReader() = default;
+
+/// Look up the branch of the column in the current tree and check that it can be read in bulk.
+bool ROOT::Internal::RDF::RTreeBulkColumnReader::SetBranch()
+{
+   fBranch = nullptr;
+   fFirstEntry = fEndEntry = -1;
+   if (!fTree)
+      return false;
+   auto branch = fTree->GetBranch(fColName.c_str());
+   // Branches of friend trees are loaded independently of the main tree, we do not track them
+   if (!branch || branch->IsA() != TBranch::Class() || branch->GetTree() != fTree || !branch->SupportsBulkRead())
+      return false;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (!IsBulkReadable(*leaf, fType))
+      return false;
+   fBranch = branch;
+   return true;
+}
+
+/// Deserialize the basket holding the given entry of the current tree.
+bool ROOT::Internal::RDF::RTreeBulkColumnReader::ReadBasket(Long64_t entry)
+{
+   if (entry < 0 || entry >= fBranch->GetEntries())
+      return false;
+   // Bulk reads start at the first entry of a basket, and only baskets written to the file can be read that way
+   const Int_t basket = TMath::BinarySearch(fBranch->GetWriteBasket() + 1, fBranch->GetBasketEntry(), entry);
+   if (basket < 0 || fBranch->GetBasketSeek(basket) == 0)
+      return false;
+   const Long64_t first = fBranch->GetBasketEntry()[basket];
+   const Int_t n = fBranch->GetBulkRead().GetBulkEntries(first, *fBuffer);
+   if (n <= 0 || entry >= first + n)
+      return false;
+
+   char *values = fBuffer->GetCurrent();
+   // The values follow the key of the basket, and are therefore not aligned in general
+   if (reinterpret_cast<std::uintptr_t>(values) % fSize != 0) {
+      fAligned.resize((n * fSize + sizeof(Long64_t) - 1) / sizeof(Long64_t));
+      std::memcpy(fAligned.data(), values, n * fSize);
+      values = reinterpret_cast<char *>(fAligned.data());
+   }
+   fValues = values;
+   fFirstEntry = first;
+   fEndEntry = first + n;
+   return true;
+}
+
+void *ROOT::Internal::RDF::RTreeBulkColumnReader::Get()
+{
+   auto chain = fReader.GetTree();
+   auto tree = chain->GetTree();
+   const auto treeNumber = chain->GetTreeNumber();
+   if (tree != fTree || treeNumber != fTreeNumber) {
+      fTree = tree;
+      fTreeNumber = treeNumber;
+      if (!SetBranch())
+         return nullptr;
+   }
+
+   const auto entry = fTree->GetReadEntry();
+   if (entry < fFirstEntry || entry >= fEndEntry) {
+      if (!ReadBasket(entry))
+         return nullptr;
+   }
+   return fValues + (entry - fFirstEntry) * fSize;
+}
@@ -0,0 +1,91 @@
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+/// The key of the variation evaluated by this thread. Only RVariedAction changes it, for the duration of its Run.
+thread_local unsigned int gActiveVariationKey = 0;
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+unsigned int GetActiveVariationKey()
+{
+   return gActiveVariationKey;
+}
+
+void SetActiveVariationKey(unsigned int key)
+{
+   gActiveVariationKey = key;
+}
+
+unsigned int RVariationBase::RegisterKeys(std::size_t nKeys)
+{
+   // key 0 is reserved for the nominal values
+   static std::atomic_uint nextKey(1U);
+   return nextKey.fetch_add(nKeys);
+}
+
+RVariationBase::RVariationBase(std::string_view columnName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type, unsigned int nSlots,
+                               const RBookedDefines &defines,
+                               const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+                               ROOT::RDF::RDataSource *ds)
+   : fColumnName(columnName), fVariationName(variationName), fTags(tags), fType(type),
+     fFirstKey(RegisterKeys(tags.size())), fNSlots(nSlots),
+     fLastCheckedEntry(fNSlots * CacheLineStep<Long64_t>(), -1), fDefines(defines), fIsInitialized(nSlots, false),
+     fDSValuePtrs(DSValuePtrs), fDataSource(ds)
+{
+}
+
+// pin vtable. Work around cling JIT issue.
+RVariationBase::~RVariationBase() {}
+
+void RVariationKeys::Add(const RVariationBase &variation)
+{
+   auto it = std::lower_bound(fVariations.begin(), fVariations.end(), &variation,
+                              [](const RVariationBase *a, const RVariationBase *b) {
+                                 return a->GetFirstKey() < b->GetFirstKey();
+                              });
+   if (it == fVariations.end() || *it != &variation)
+      fVariations.insert(it, &variation);
+}
+
+void RVariationKeys::Merge(const RVariationKeys &other)
+{
+   for (auto variation : other.fVariations)
+      Add(*variation);
+}
+
+RVariationKeys GetColumnVariationKeys(const std::vector<std::string> &columns, const RBookedDefines &defines)
+{
+   RVariationKeys keys;
+   const auto &variations = defines.GetVariations();
+   const auto &defineMap = defines.GetColumns();
+   for (const auto &column : columns) {
+      const auto variationIt = variations.find(column);
+      if (variationIt != variations.end())
+         keys.Add(*variationIt->second);
+      const auto defineIt = defineMap.find(column);
+      if (defineIt != defineMap.end())
+         keys.Merge(defineIt->second->GetVariationKeys());
+   }
+   return keys;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
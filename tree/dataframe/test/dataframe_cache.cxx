@@ -346,3 +346,60 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+TEST(Cache, PersistentCache)
+{
+   const auto cacheDir = "dataframe_cache_persistentcache";
+   gSystem->mkdir(cacheDir);
+   int nCalls = 0;
+   auto makeCache = [&](std::string_view version, std::string_view filter = "x > 1") {
+      ROOT::RDataFrame df(5);
+      df.SetCacheDirectory(cacheDir, version);
+      return df.Define("x", [&nCalls](ULong64_t e) { ++nCalls; return int(e); }, {"rdfentry_"})
+         .Filter(filter)
+         .Cache<int>({"x"});
+   };
+
+   // the first call computes the cached columns and writes them to disk
+   auto cached1 = makeCache("v1");
+   EXPECT_EQ(nCalls, 5);
+   EXPECT_EQ(*cached1.Sum<int>("x"), 9);
+
+   // expressions jitted for unrelated computation graphs are not part of the key
+   EXPECT_EQ(*ROOT::RDataFrame(1).Filter("rdfentry_ < 100").Count(), 1ull);
+
+   // an equivalent call reads them back without running the upstream graph
+   auto cached2 = makeCache("v1");
+   EXPECT_EQ(nCalls, 5);
+   EXPECT_EQ(*cached2.Sum<int>("x"), 9);
+   EXPECT_EQ(*cached2.Count(), 3ull);
+
+   // a different version does not hit the cache
+   auto cached3 = makeCache("v2");
+   EXPECT_EQ(nCalls, 10);
+   EXPECT_EQ(*cached3.Sum<int>("x"), 9);
+
+   // neither does a different upstream expression
+   auto cached4 = makeCache("v1", "x > 2");
+   EXPECT_EQ(nCalls, 15);
+   EXPECT_EQ(*cached4.Sum<int>("x"), 7);
+
+   // jitted Cache calls share the cache with the typed ones
+   ROOT::RDataFrame df(5);
+   df.SetCacheDirectory(cacheDir, "v1");
+   auto cachedj = df.Define("x", [&nCalls](ULong64_t e) { ++nCalls; return int(e); }, {"rdfentry_"})
+                     .Filter("x > 1")
+                     .Cache({"x"});
+   EXPECT_EQ(nCalls, 15);
+   EXPECT_EQ(*cachedj.Sum<int>("x"), 9);
+
+   void *dir = gSystem->OpenDirectory(cacheDir);
+   ASSERT_NE(dir, nullptr);
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string entryName(entry);
+      if (entryName != "." && entryName != "..")
+         gSystem->Unlink((std::string(cacheDir) + "/" + entryName).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+}
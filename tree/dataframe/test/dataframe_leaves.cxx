@@ -1,5 +1,8 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 #include "gtest/gtest.h"
 
@@ -72,3 +75,119 @@ TEST(RDFLeaves, OneLeafWithDotNameClass)
    EXPECT_EQ(*res, 40);
 }
 
+
+// Fundamental-type columns are read one basket at a time, see RTreeBulkColumnReader
+class RDFBulkRead : public ::testing::Test {
+protected:
+   static constexpr const char *fFileNames[] = {"dataframe_leaves_bulkread_0.root",
+                                                "dataframe_leaves_bulkread_1.root"};
+   static constexpr Long64_t fNEntries = 1000;
+
+   static void SetUpTestCase()
+   {
+      for (auto fileIdx : ROOT::TSeqI(2)) {
+         TFile f(fFileNames[fileIdx], "RECREATE");
+         TTree t("t", "t");
+         t.SetAutoFlush(128);
+         Short_t s = 0;
+         Int_t i = 0;
+         Long64_t l = 0;
+         Float_t f32 = 0;
+         Double_t d = 0;
+         Bool_t o = false;
+         Int_t arr[2] = {0, 0};
+         t.Branch("s", &s);
+         t.Branch("i", &i);
+         t.Branch("l", &l);
+         t.Branch("f", &f32);
+         t.Branch("d", &d);
+         t.Branch("o", &o);
+         t.Branch("arr", arr, "arr[2]/I");
+         for (auto e : ROOT::TSeqL(fNEntries)) {
+            const auto n = fileIdx * fNEntries + e;
+            s = n % 1000;
+            i = -n;
+            l = n * 1000000000ll;
+            f32 = 0.5f * n;
+            d = 0.25 * n;
+            o = n % 2;
+            arr[0] = n;
+            arr[1] = 2 * n;
+            t.Fill();
+         }
+         t.Write();
+      }
+   }
+
+   static void TearDownTestCase()
+   {
+      for (auto fileName : fFileNames)
+         gSystem->Unlink(fileName);
+   }
+};
+
+constexpr const char *RDFBulkRead::fFileNames[];
+constexpr Long64_t RDFBulkRead::fNEntries;
+
+TEST_F(RDFBulkRead, Values)
+{
+   ROOT::RDataFrame df("t", fFileNames[0]);
+   auto s = df.Take<Short_t>("s");
+   auto i = df.Take<Int_t>("i");
+   auto l = df.Take<Long64_t>("l");
+   auto f = df.Take<Float_t>("f");
+   auto d = df.Take<Double_t>("d");
+   ASSERT_EQ(s->size(), std::size_t(fNEntries));
+   for (auto n : ROOT::TSeqL(fNEntries)) {
+      EXPECT_EQ((*s)[n], n % 1000);
+      EXPECT_EQ((*i)[n], -n);
+      EXPECT_EQ((*l)[n], n * 1000000000ll);
+      EXPECT_FLOAT_EQ((*f)[n], 0.5f * n);
+      EXPECT_DOUBLE_EQ((*d)[n], 0.25 * n);
+   }
+}
+
+TEST_F(RDFBulkRead, RangeAndFilter)
+{
+   ROOT::RDataFrame df("t", fFileNames[0]);
+   // Start and end in the middle of baskets, skip whole baskets
+   auto range = df.Range(100, 900).Filter([](Int_t i) { return -i % 300 < 10; }, {"i"});
+   auto d = range.Take<Double_t>("d");
+   auto i = range.Take<Int_t>("i");
+   ASSERT_EQ(d->size(), i->size());
+   ASSERT_FALSE(d->empty());
+   for (auto n : ROOT::TSeqUL(d->size()))
+      EXPECT_DOUBLE_EQ((*d)[n], -0.25 * (*i)[n]);
+   EXPECT_EQ(*range.Count(), 20ull);
+}
+
+TEST_F(RDFBulkRead, Chain)
+{
+   TChain c("t");
+   for (auto fileName : fFileNames)
+      c.Add(fileName);
+   ROOT::RDataFrame df(c);
+   auto sum = df.Sum<Long64_t>("l");
+   auto l = df.Take<Long64_t>("l");
+   ASSERT_EQ(l->size(), std::size_t(2 * fNEntries));
+   for (auto n : ROOT::TSeqL(2 * fNEntries))
+      EXPECT_EQ((*l)[n], n * 1000000000ll);
+   EXPECT_EQ(*sum, (2 * fNEntries - 1) * fNEntries * 1000000000ll);
+}
+
+TEST_F(RDFBulkRead, Fallback)
+{
+   ROOT::RDataFrame df("t", fFileNames[1]);
+   // bool and array branches are read via TTreeReader, alongside columns read in bulk
+   auto o = df.Take<Bool_t>("o");
+   auto arr = df.Take<RVec<Int_t>>("arr");
+   auto sumJit = df.Sum("i");
+   ASSERT_EQ(o->size(), std::size_t(fNEntries));
+   for (auto e : ROOT::TSeqL(fNEntries)) {
+      const auto n = fNEntries + e;
+      EXPECT_EQ((*o)[e], n % 2 == 1);
+      EXPECT_EQ((*arr)[e][0], n);
+      EXPECT_EQ((*arr)[e][1], 2 * n);
+   }
+   EXPECT_DOUBLE_EQ(*sumJit, -(3 * fNEntries - 1) * fNEntries / 2.);
+}
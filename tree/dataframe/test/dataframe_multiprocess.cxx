@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RTrivialDS.hxx>
+#include <TEntryList.h>
+#include <TCollection.h>
+#include <TFile.h>
+#include <TH1D.h>
+#include <TSystem.h>
+#include <TObject.h>
+#include <TTree.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+TEST(RDFMultiProcess, EmptySource)
+{
+   ROOT::RDataFrame df(1000);
+   df.SetNProcesses(4);
+   auto dfx = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto count = dfx.Filter([](double x) { return x < 500; }, {"x"}).Count();
+   auto sum = dfx.Sum<double>("x");
+   auto max = dfx.Max<double>("x");
+   auto mean = dfx.Mean<double>("x");
+   auto h = dfx.Histo1D<double>({"h", "h", 10, 0, 1000}, "x");
+
+   EXPECT_EQ(*count, 500ull);
+   EXPECT_DOUBLE_EQ(*sum, 499500.);
+   EXPECT_DOUBLE_EQ(*max, 999.);
+   EXPECT_DOUBLE_EQ(*mean, 499.5);
+   EXPECT_EQ(h->GetEntries(), 1000);
+   EXPECT_DOUBLE_EQ(h->GetBinContent(1), 100.);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+
+   // the results of later event loops are not affected by the previous ones
+   auto count2 = df.Count();
+   EXPECT_EQ(*count2, 1000ull);
+}
+
+TEST(RDFMultiProcess, MoreProcessesThanEntries)
+{
+   ROOT::RDataFrame df(3);
+   df.SetNProcesses(8);
+   EXPECT_EQ(*df.Count(), 3ull);
+}
+
+TEST(RDFMultiProcess, TTree)
+{
+   const auto fileName = "dataframe_multiprocess_ttree.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < 100; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDataFrame df("t", fileName);
+   df.SetNProcesses(3);
+   auto sum = df.Sum<int>("x");
+   auto min = df.Min<int>("x");
+   EXPECT_EQ(*sum, 4950);
+   EXPECT_EQ(*min, 0);
+
+   gSystem->Unlink(fileName);
+}
+
+// the entries are split by their index in the entry list
+TEST(RDFMultiProcess, EntryList)
+{
+   const auto fileName = "dataframe_multiprocess_entrylist.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < 100; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      TEntryList elist("elist", "elist", t);
+      for (auto e = 0; e < 100; e += 10)
+         elist.Enter(e);
+      t->SetEntryList(&elist);
+
+      ROOT::RDataFrame df(*t);
+      df.SetNProcesses(4);
+      auto count = df.Count();
+      auto sum = df.Sum<int>("x");
+      EXPECT_EQ(*count, 10ull);
+      EXPECT_EQ(*sum, 450);
+      t->SetEntryList(nullptr);
+   }
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(RDFMultiProcess, DataSource)
+{
+   ROOT::RDataFrame df(std::make_unique<ROOT::RDF::RTrivialDS>(100));
+   df.SetNProcesses(2);
+   EXPECT_EQ(*df.Sum<ULong64_t>("col0"), 4950ull);
+}
+
+TEST(RDFMultiProcess, Unsupported)
+{
+   ROOT::RDataFrame df(10);
+   df.SetNProcesses(2);
+   auto take = df.Take<ULong64_t>("rdfentry_");
+   EXPECT_THROW(take.GetValue(), std::logic_error);
+
+   ROOT::RDataFrame df2(10);
+   df2.SetNProcesses(2);
+   auto rangeCount = df2.Range(5).Count();
+   EXPECT_THROW(rangeCount.GetValue(), std::logic_error);
+}
+
+// Can be filled and merged, but has no dictionary: the worker processes cannot send it back
+class NoDictCounter : public TObject {
+public:
+   Long64_t fN = 0;
+   void Fill(double) { ++fN; }
+   Long64_t Merge(TCollection *others)
+   {
+      for (auto *other : *others)
+         fN += static_cast<NoDictCounter *>(other)->fN;
+      return fN;
+   }
+};
+
+TEST(RDFMultiProcess, NoDictionary)
+{
+   ROOT::RDataFrame df(10);
+   df.SetNProcesses(2);
+   auto counter = df.Fill<ULong64_t>(NoDictCounter(), {"rdfentry_"});
+   try {
+      counter.GetValue();
+      FAIL() << "the event loop should not start";
+   } catch (const std::runtime_error &e) {
+      EXPECT_NE(std::string(e.what()).find("there is no dictionary for"), std::string::npos) << e.what();
+   }
+   EXPECT_EQ(df.GetNRuns(), 0u);
+}
+
+TEST(RDFMultiProcess, ErrorInWorker)
+{
+   ROOT::RDataFrame df(10);
+   df.SetNProcesses(2);
+   auto count = df.Filter([](ULong64_t e) -> bool {
+                     if (e == 7)
+                        throw std::runtime_error("bad entry");
+                     return true;
+                  },
+                  {"rdfentry_"})
+                   .Count();
+   EXPECT_THROW(count.GetValue(), std::runtime_error);
+}
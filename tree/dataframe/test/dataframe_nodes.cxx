@@ -5,6 +5,8 @@
 #include <TStatistic.h> // To check reading of columns with types which are mothers of the column type
 #include <TSystem.h>
 
+#include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <stdexcept> // std::runtime_error
@@ -44,6 +46,42 @@ TEST(RDataFrameNodes, RSlotStackPutBackTooMany)
 
 #endif
 
+TEST(RDataFrameNodes, RSlotStackConcurrentUse)
+{
+   // more slots than fit in one word of the free-slot mask
+   const unsigned int nSlots = 70;
+   ROOT::Internal::RDF::RSlotStack s(nSlots);
+   std::vector<std::atomic<int>> nHolders(nSlots);
+   for (auto &n : nHolders)
+      n = 0;
+   std::atomic<bool> shared{false};
+
+   std::vector<std::thread> ts;
+   for (unsigned int i = 0; i < 8; ++i) {
+      ts.emplace_back([&]() {
+         for (int iter = 0; iter < 10000; ++iter) {
+            const auto slot = s.GetSlot();
+            if (slot >= nSlots || nHolders[slot]++ != 0)
+               shared = true;
+            else
+               nHolders[slot]--;
+            s.ReturnSlot(slot);
+         }
+      });
+   }
+   for (auto &&t : ts)
+      t.join();
+
+   EXPECT_FALSE(shared);
+   // all slots are free again
+   std::vector<unsigned int> slots;
+   for (unsigned int i = 0; i < nSlots; ++i)
+      slots.emplace_back(s.GetSlot());
+   std::sort(slots.begin(), slots.end());
+   for (unsigned int i = 0; i < nSlots; ++i)
+      EXPECT_EQ(slots[i], i);
+}
+
 TEST(RDataFrameNodes, RLoopManagerGetLoopManagerUnchecked)
 {
    ROOT::Detail::RDF::RLoopManager lm(nullptr, {});
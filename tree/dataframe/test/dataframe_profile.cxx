@@ -0,0 +1,163 @@
+/****** Run RDataFrame tests both with and without IMT enabled *******/
+#include <gtest/gtest.h>
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <TROOT.h>
+#include <TSystem.h>
+#include <TVirtualPerfStats.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+using ROOT::RDF::RNodeProfileInfo;
+using ROOT::RDF::RProfileReport;
+
+// Fixture for all tests in this file. If parameter is true, run with implicit MT, else run sequentially
+class RDFProfile : public ::testing::TestWithParam<bool> {
+protected:
+   RDFProfile() : NSLOTS(GetParam() ? std::min(4u, std::thread::hardware_concurrency()) : 1u)
+   {
+      if (GetParam())
+         ROOT::EnableImplicitMT(NSLOTS);
+   }
+   ~RDFProfile()
+   {
+      if (GetParam())
+         ROOT::DisableImplicitMT();
+   }
+   const unsigned int NSLOTS;
+};
+
+static const RNodeProfileInfo &GetNode(const RProfileReport &report, const std::string &kind, const std::string &name)
+{
+   auto it = std::find_if(report.begin(), report.end(), [&](const RNodeProfileInfo &n) {
+      return n.GetKind() == kind && n.GetName() == name;
+   });
+   if (it == report.end())
+      throw std::runtime_error("no " + kind + " node called " + name);
+   return *it;
+}
+
+TEST_P(RDFProfile, NodeCounters)
+{
+   ROOT::RDataFrame df(100);
+   df.SetProfiling(true);
+   auto even = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                  .Filter([](int x) { return x % 2 == 0; }, {"x"}, "even");
+   auto sum = even.Define("y", [](int x) { return 2 * x; }, {"x"}).Sum<int>("y");
+   auto jittedSum = even.Define("z", "x * 3").Sum<int>("z");
+   EXPECT_EQ(*sum, 4900);
+   EXPECT_EQ(*jittedSum, 7350);
+
+   const auto report = df.GetProfileReport();
+   EXPECT_EQ(report.GetNRuns(), 1u);
+   EXPECT_EQ(report.GetNEntries(), 100ull);
+   EXPECT_EQ(GetNode(report, "Define", "x").GetNCalls(), 100ull);
+   EXPECT_EQ(GetNode(report, "Filter", "even").GetNCalls(), 100ull);
+   EXPECT_EQ(GetNode(report, "Define", "y").GetNCalls(), 50ull);
+   EXPECT_EQ(GetNode(report, "Define", "z").GetNCalls(), 50ull);
+   EXPECT_EQ(GetNode(report, "Action", "Sum").GetNCalls(), 50ull);
+   for (const auto &node : report) {
+      EXPECT_EQ(node.GetNSlots(), NSLOTS);
+      EXPECT_TRUE(node.GetTime() >= 0.);
+   }
+
+   const auto json = report.AsJSON();
+   EXPECT_TRUE(json.find("\"kind\": \"Filter\", \"name\": \"even\", \"calls\": 100") != std::string::npos);
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_TRUE(graph.find("even\n100 calls") != std::string::npos);
+}
+
+TEST_P(RDFProfile, Disabled)
+{
+   ROOT::RDataFrame df(10);
+   auto count = df.Filter([] { return true; }).Count();
+   EXPECT_EQ(*count, 10ull);
+
+   const auto report = df.GetProfileReport();
+   EXPECT_EQ(report.GetNRuns(), 0u);
+   EXPECT_EQ(report.GetNEntries(), 0ull);
+   EXPECT_EQ(GetNode(report, "Filter", "Filter").GetNCalls(), 0ull);
+   EXPECT_EQ(GetNode(report, "Action", "Count").GetNCalls(), 0ull);
+   EXPECT_TRUE(ROOT::RDF::SaveGraph(df).find("calls") == std::string::npos);
+}
+
+TEST_P(RDFProfile, TreeIO)
+{
+   const auto fileName = std::string("dataframe_profile_treeio") + (GetParam() ? "_mt" : "") + ".root";
+   ROOT::RDataFrame(1000).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Snapshot("t", fileName);
+
+   ROOT::RDataFrame df("t", fileName);
+   df.SetProfiling(true);
+   EXPECT_DOUBLE_EQ(*df.Sum<double>("x"), 499500.);
+
+   const auto report = df.GetProfileReport();
+   EXPECT_EQ(report.GetNEntries(), 1000ull);
+   EXPECT_TRUE(report.GetBytesRead() > 0ull);
+   EXPECT_TRUE(report.GetReadCalls() > 0ull);
+   EXPECT_TRUE(report.GetUnzippedBytes() > 0ull);
+   EXPECT_TRUE(report.GetRealTime() > 0.);
+
+   gSystem->Unlink(fileName.c_str());
+}
+
+// Counts the file reads it is notified of
+class RReadCounter final : public TVirtualPerfStats {
+   void SetFile(TFile *) final {}
+
+public:
+   Long64_t fBytesRead = 0;
+
+   void FileReadEvent(TFile *, Int_t len, Double_t) final { fBytesRead += len; }
+   void UnzipEvent(TObject *, Long64_t, Double_t, Int_t, Int_t) final {}
+   void SimpleEvent(EEventType) final {}
+   void PacketEvent(const char *, const char *, const char *, Long64_t, Double_t, Double_t, Double_t, Long64_t) final {}
+   void FileEvent(const char *, const char *, const char *, const char *, Bool_t) final {}
+   void FileOpenEvent(TFile *, const char *, Double_t) final {}
+   void RateEvent(Double_t, Double_t, Long64_t, Long64_t) final {}
+   void SetBytesRead(Long64_t) final {}
+   Long64_t GetBytesRead() const final { return fBytesRead; }
+   void SetNumEvents(Long64_t) final {}
+   Long64_t GetNumEvents() const final { return 0; }
+   void PrintBasketInfo(Option_t * = "") const final {}
+   void SetLoaded(TBranch *, size_t) final {}
+   void SetLoaded(size_t, size_t) final {}
+   void SetLoadedMiss(TBranch *, size_t) final {}
+   void SetLoadedMiss(size_t, size_t) final {}
+   void SetMissed(TBranch *, size_t) final {}
+   void SetMissed(size_t, size_t) final {}
+   void SetUsed(TBranch *, size_t) final {}
+   void SetUsed(size_t, size_t) final {}
+   void UpdateBranchIndices(TObjArray *) final {}
+};
+
+// The gPerfStats of the user keeps receiving the I/O events of a profiled event loop
+TEST(RDFProfileSeq, UserPerfStats)
+{
+   const auto fileName = "dataframe_profile_userperfstats.root";
+   ROOT::RDataFrame(1000).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Snapshot("t", fileName);
+
+   RReadCounter counter;
+   auto prevPerfStats = gPerfStats;
+   gPerfStats = &counter;
+   {
+      ROOT::RDataFrame df("t", fileName);
+      df.SetProfiling(true);
+      EXPECT_DOUBLE_EQ(*df.Sum<double>("x"), 499500.);
+      EXPECT_EQ(gPerfStats, &counter);
+      EXPECT_TRUE(df.GetProfileReport().GetBytesRead() > 0ull);
+   }
+   gPerfStats = prevPerfStats;
+   EXPECT_TRUE(counter.fBytesRead > 0);
+
+   gSystem->Unlink(fileName);
+}
+
+// run single-thread tests
+INSTANTIATE_TEST_SUITE_P(Seq, RDFProfile, ::testing::Values(false));
+
+// run multi-thread tests
+#ifdef R__USE_IMT
+   INSTANTIATE_TEST_SUITE_P(MT, RDFProfile, ::testing::Values(true));
+#endif
@@ -15,6 +15,7 @@
 #include <algorithm> // std::sort
 #include <array>
 #include <chrono>
+#include <cmath>
 #include <thread>
 #include <set>
 #include <random>
@@ -438,6 +439,41 @@ TEST_P(RDFSimpleTests, GetNRuns)
    EXPECT_EQ(df.GetNRuns(), 2u);
 }
 
+TEST_P(RDFSimpleTests, BufferedHisto1D)
+{
+   // Histo1D with fixed binning buffers the values and fills the histogram in batches: the result must be the same as
+   // filling it one value at a time, also for underflows, overflows, NaNs and weights
+   const auto nEntries = 10000u;
+   auto value = [](ULong64_t e) { return e % 97 == 0 ? std::nan("") : double(e % 1000) / 10. - 20.; };
+   auto weight = [](ULong64_t e) { return e % 2 ? 1. : 0.5; };
+   TH1D ref("ref", "ref", 50, 0., 70.);
+   TH1D refW("refW", "refW", 50, 0., 70.);
+   for (ULong64_t e = 0; e < nEntries; ++e) {
+      ref.Fill(value(e));
+      refW.Fill(value(e), weight(e));
+   }
+
+   ROOT::RDataFrame df(nEntries);
+   auto d = df.Define("x", value, {"rdfentry_"}).Define("w", weight, {"rdfentry_"});
+   auto h = d.Histo1D<double>({"h", "h", 50, 0., 70.}, "x");
+   auto hW = d.Histo1D<double, double>({"hW", "hW", 50, 0., 70.}, "x", "w");
+   auto hColl = d.Define("xs", [](double x) { return RVec<double>{x, x}; }, {"x"})
+                   .Histo1D<RVec<double>>({"hColl", "hColl", 50, 0., 70.}, "xs");
+
+   EXPECT_EQ(h->GetEntries(), ref.GetEntries());
+   EXPECT_NEAR(h->GetMean(), ref.GetMean(), 1e-9);
+   EXPECT_NEAR(h->GetStdDev(), ref.GetStdDev(), 1e-9);
+   EXPECT_NEAR(hW->GetMean(), refW.GetMean(), 1e-9);
+   EXPECT_DOUBLE_EQ(hW->GetSumOfWeights(), refW.GetSumOfWeights());
+   EXPECT_EQ(hColl->GetEntries(), 2 * ref.GetEntries());
+   for (int bin = 0; bin <= 51; ++bin) {
+      EXPECT_DOUBLE_EQ(h->GetBinContent(bin), ref.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hW->GetBinContent(bin), refW.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hW->GetBinError(bin), refW.GetBinError(bin));
+      EXPECT_DOUBLE_EQ(hColl->GetBinContent(bin), 2 * ref.GetBinContent(bin));
+   }
+}
+
 TEST_P(RDFSimpleTests, CArraysFromTree)
 {
    auto filename = "dataframe_simple_3.root";
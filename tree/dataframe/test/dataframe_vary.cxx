@@ -0,0 +1,129 @@
+/****** Run RDataFrame tests both with and without IMT enabled *******/
+#include <gtest/gtest.h>
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RVec.hxx>
+#include <TROOT.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+// Fixture for all tests in this file. If parameter is true, run with implicit MT, else run sequentially
+class RDFVary : public ::testing::TestWithParam<bool> {
+protected:
+   RDFVary() : NSLOTS(GetParam() ? std::min(4u, std::thread::hardware_concurrency()) : 1u)
+   {
+      if (GetParam())
+         ROOT::EnableImplicitMT(NSLOTS);
+   }
+   ~RDFVary()
+   {
+      if (GetParam())
+         ROOT::DisableImplicitMT();
+   }
+   const unsigned int NSLOTS;
+};
+
+TEST_P(RDFVary, SimpleSum)
+{
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto sum = df.Vary("x", [](int x) { return RVec<int>{x - 1, x + 1}; }, {"x"}, {"down", "up"}).Sum<int>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), (std::vector<std::string>{"nominal", "x:down", "x:up"}));
+   EXPECT_EQ(*sums["nominal"], 45);
+   EXPECT_EQ(*sums["x:down"], 35);
+   EXPECT_EQ(*sums["x:up"], 55);
+   EXPECT_EQ(*sum, 45);
+}
+
+TEST_P(RDFVary, FilterAndDefineDownstream)
+{
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Vary("x", [](double x) { return RVec<double>{x - 5, x + 5}; }, {"x"}, 2, "shift")
+                .Define("y", [](double x) { return 2 * x; }, {"x"})
+                .Filter([](double y) { return y >= 10; }, {"y"}, "ycut");
+   auto count = df.Count();
+   auto histo = df.Histo1D<double>({"h", "h", 40, -20, 40}, "y");
+   auto counts = VariationsFor(count);
+   auto histos = VariationsFor(histo);
+
+   EXPECT_EQ(*counts["nominal"], 5ull);
+   EXPECT_EQ(*counts["shift:0"], 0ull);
+   EXPECT_EQ(*counts["shift:1"], 10ull);
+   EXPECT_EQ(histos["nominal"]->GetEntries(), 5);
+   EXPECT_DOUBLE_EQ(histos["shift:1"]->GetMean(), 19.);
+
+   // the filter report only counts the nominal selection
+   auto report = df.Report();
+   EXPECT_EQ(report->At("ycut").GetPass(), 5ull);
+   EXPECT_EQ(report->At("ycut").GetAll(), 10ull);
+}
+
+TEST_P(RDFVary, UnaffectedAction)
+{
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", [] { return 1; })
+                .Define("y", [] { return 2; })
+                .Vary("x", [](int x) { return RVec<int>{x - 1, x + 1}; }, {"x"}, {"down", "up"});
+   auto sums = VariationsFor(df.Sum<int>("y"));
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>{"nominal"});
+   EXPECT_EQ(*sums["nominal"], 20);
+   EXPECT_THROW(sums["x:up"], std::runtime_error);
+}
+
+TEST_P(RDFVary, Jitted)
+{
+   auto df = ROOT::RDataFrame(10)
+                .Define("x", "int(rdfentry_)")
+                .Vary("x", [](int x) { return RVec<int>{x * 2}; }, {"x"}, {"twice"}, "scale")
+                .Filter("x > 7");
+   auto counts = VariationsFor(df.Count());
+
+   EXPECT_EQ(*counts["nominal"], 2ull);
+   EXPECT_EQ(*counts["scale:twice"], 6ull);
+}
+
+TEST_P(RDFVary, Errors)
+{
+   auto df = ROOT::RDataFrame(1).Define("x", [] { return 1; });
+   auto varied = df.Vary("x", [](int x) { return RVec<int>{x, x}; }, {"x"}, {"a", "b"});
+   EXPECT_THROW(varied.Vary("x", [](int x) { return RVec<int>{x}; }, {"x"}, {"a"}), std::runtime_error);
+   EXPECT_THROW(df.Vary("x", [](int x) { return RVec<int>{x}; }, {"x"}, std::vector<std::string>{}),
+                std::runtime_error);
+   EXPECT_THROW(df.Vary("z", [](int x) { return RVec<int>{x}; }, {"x"}, {"a"}), std::runtime_error);
+
+   auto sum = varied.Sum<int>("x");
+   EXPECT_EQ(*sum, 1);
+   EXPECT_THROW(VariationsFor(sum), std::runtime_error);
+
+   // Range is not supported downstream of a varied filter
+   if (!GetParam()) {
+      auto rangeSum = varied.Filter([](int x) { return x > 0; }, {"x"}).Range(1).Sum<int>("x");
+      EXPECT_THROW(VariationsFor(rangeSum), std::logic_error);
+   }
+}
+
+TEST_P(RDFVary, WrongNumberOfValues)
+{
+   // the expression must return one value per tag
+   auto sum = ROOT::RDataFrame(1)
+                 .Define("x", [] { return 1; })
+                 .Vary("x", [](int x) { return RVec<int>{x}; }, {"x"}, {"a", "b"})
+                 .Sum<int>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_THROW(*sums["x:a"], std::runtime_error);
+}
+
+// run single-thread tests
+INSTANTIATE_TEST_SUITE_P(Seq, RDFVary, ::testing::Values(false));
+
+// run multi-thread tests
+#ifdef R__USE_IMT
+   INSTANTIATE_TEST_SUITE_P(MT, RDFVary, ::testing::Values(true));
+#endif
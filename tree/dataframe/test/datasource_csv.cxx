@@ -2,9 +2,11 @@
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <iostream>
 
 using namespace ROOT::RDF;
@@ -248,6 +250,42 @@ TEST(RCsvDS, WindowsLinebreaks)
    EXPECT_EQ(6U, *tdf.Count());
 }
 
+TEST(RCsvDS, ParseError)
+{
+   const auto fname = "RCsvDS_test_parseerror.csv";
+   {
+      std::ofstream f(fname);
+      f << "x,y\n1,a\n2,b\nthree,c\n";
+   }
+   auto tdf = ROOT::RDF::MakeCsvDataFrame(fname);
+   EXPECT_THROW(*tdf.Sum<Long64_t>("x"), std::runtime_error);
+
+   // values must span the whole field, and booleans must be either true or false
+   auto expectParseError = [&](const char *content, const char *column) {
+      {
+         std::ofstream f(fname);
+         f << content;
+      }
+      auto df = ROOT::RDF::MakeCsvDataFrame(fname);
+      EXPECT_THROW(df.Display({column})->Print(), std::runtime_error) << content;
+   };
+   expectParseError("x,y\n1,a\n3x,b\n", "x");
+   expectParseError("x,y\n1,a\n1.5,b\n", "x");
+   expectParseError("x,y\n1.5,a\n2.5y,b\n", "x");
+   expectParseError("x,y\ntrue,a\nyes,b\n", "x");
+   expectParseError("x,y\ntrue,a\ntruex,b\n", "x");
+
+   // trailing blanks and Fortran-style exponents are accepted
+   {
+      std::ofstream f(fname);
+      f << "x,y\n1,1.5\n2 ,2.5d1\n";
+   }
+   auto df = ROOT::RDF::MakeCsvDataFrame(fname);
+   EXPECT_EQ(*df.Sum<Long64_t>("x"), 3);
+   EXPECT_DOUBLE_EQ(*df.Sum<double>("y"), 26.5);
+   gSystem->Unlink(fname);
+}
+
 TEST(RCsvDS, Remote)
 {
    (void)url0; // silence -Wunused-const-variable
@@ -320,6 +358,31 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ParallelParsingMT)
+{
+   const auto fname = "RCsvDS_test_parallel.csv";
+   const auto nLines = 100000LL;
+   {
+      std::ofstream f(fname);
+      f << "i,half,name\n";
+      for (auto i : ROOT::TSeqL(nLines))
+         f << i << ',' << i * 0.5 << ",\"n" << i % 10 << ",\"\"x\"\"\"\n";
+   }
+
+   ROOT::EnableImplicitMT(4);
+   for (auto chunkSize : {-1LL, 1000LL}) {
+      auto tdf = ROOT::RDF::MakeCsvDataFrame(fname, true, ',', chunkSize);
+      auto sumI = tdf.Sum<Long64_t>("i");
+      auto sumHalf = tdf.Sum<double>("half");
+      auto nGood = tdf.Filter([](const std::string &n) { return n.size() == 6 && n.substr(2) == ",\"x\""; }, {"name"})
+                      .Count();
+      EXPECT_EQ(nLines * (nLines - 1) / 2, *sumI);
+      EXPECT_DOUBLE_EQ(nLines * (nLines - 1) / 4., *sumHalf);
+      EXPECT_EQ(ULong64_t(nLines), *nGood);
+   }
+   gSystem->Unlink(fname);
+}
+
 #endif // R__USE_IMT
 
 #endif // R__B64
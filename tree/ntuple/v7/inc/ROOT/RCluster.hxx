@@ -18,6 +18,7 @@
 
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -142,6 +143,51 @@ public:
    ~ROnDiskPageMapHeap();
 };
 
+class RPageAllocatorArena;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapArena
+\ingroup NTuple
+\brief An ROnDiskPageMap whose fMemory is taken from an RPageAllocatorArena
+
+The memory region is given back to the arena as a whole when the cluster containing the page map is destructed.
+*/
+// clang-format on
+class ROnDiskPageMapArena : public ROnDiskPageMap {
+private:
+   std::shared_ptr<RPageAllocatorArena> fArena;
+   /// The memory region containing the on-disk pages, allocated by fArena
+   unsigned char *fMemory;
+   std::size_t fSize;
+public:
+   ROnDiskPageMapArena(std::shared_ptr<RPageAllocatorArena> arena, unsigned char *memory, std::size_t size)
+      : fArena(std::move(arena)), fMemory(memory), fSize(size) {}
+   ROnDiskPageMapArena(const ROnDiskPageMapArena &other) = delete;
+   ROnDiskPageMapArena &operator =(const ROnDiskPageMapArena &other) = delete;
+   ~ROnDiskPageMapArena();
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapMmap
+\ingroup NTuple
+\brief An ROnDiskPageMap whose pages are located in a read-only memory mapping of the entire file
+
+The mapping is shared by all the clusters of a page source as well as by the pages that point directly into the
+mapped region.  It is unmapped when the last of them is gone.
+*/
+// clang-format on
+class ROnDiskPageMapMmap : public ROnDiskPageMap {
+private:
+   std::shared_ptr<const unsigned char> fMapping;
+public:
+   explicit ROnDiskPageMapMmap(std::shared_ptr<const unsigned char> mapping) : fMapping(std::move(mapping)) {}
+   ROnDiskPageMapMmap(const ROnDiskPageMapMmap &other) = delete;
+   ROnDiskPageMapMmap &operator =(const ROnDiskPageMapMmap &other) = delete;
+   ~ROnDiskPageMapMmap();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RCluster
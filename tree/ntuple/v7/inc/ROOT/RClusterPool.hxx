@@ -20,13 +20,19 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx> // for ColumnSet_t
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <future>
+#include <map>
 #include <queue>
 #include <thread>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 namespace ROOT {
@@ -55,9 +61,6 @@ compressed pages and the page source has to uncompresses pages at a later point
 // clang-format on
 class RClusterPool {
 private:
-   /// Maximum number of queued cluster requests for the I/O thread. A single request can span mutliple clusters.
-   static constexpr unsigned int kWorkQueueLimit = 4;
-
    /// Request to load a subset of the columns of a particular cluster.
    /// Work items come in groups and are executed by the page source.
    struct RReadItem {
@@ -96,6 +99,31 @@ private:
    unsigned int fWindowPre;
    /// The number of desired clusters in the pool, including the currently active cluster
    unsigned int fWindowPost;
+   /// If non-zero, the look-ahead window is bounded by the uncompressed size of the requested columns of its clusters
+   /// instead of by fWindowPost.  The clusters of the look-back window are only kept as long as they fit, too.
+   std::size_t fMemoryBudget = 0;
+   /// The in-memory element size of the columns seen by GetClusterSize(), by column id
+   std::unordered_map<DescriptorId_t, std::size_t> fElementSizes;
+   /// Whether fWindowAhead follows the observed read, unzip, and processing times
+   bool fIsAdaptive = false;
+   /// The current number of clusters in the look-ahead window, including the currently active cluster.  If the
+   /// pool is adaptive, it is the number of clusters that need to be in flight to hide the loading latency.
+   unsigned int fWindowAhead;
+   /// If the read options specify entry ranges, maps the first entry to the cluster id of the clusters that overlap
+   /// with the entry ranges.  Other clusters are not preloaded.  Filled lazily because the descriptor is not yet
+   /// available on construction.
+   std::map<NTupleSize_t, DescriptorId_t> fSelectedClusters;
+   bool fIsSelectionInitialized = false;
+
+   /// Moving average of the wall time to read a cluster, updated by the I/O thread
+   std::atomic<std::int64_t> fTimeReadNs{0};
+   /// Moving average of the wall time to unzip a cluster, updated by the unzip thread
+   std::atomic<std::int64_t> fTimeUnzipNs{0};
+   /// Moving average of the wall time the main thread spends between getting one cluster and asking for the next
+   std::int64_t fTimeProcessNs = 0;
+   /// The cluster id and time of the last GetCluster() call, used to measure the processing time
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   std::chrono::steady_clock::time_point fLastClusterTime;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
 
@@ -126,9 +154,18 @@ private:
 
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
-   /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
-   /// make sure that a free slot actually exists
-   size_t FindFreeSlot() const;
+   /// Returns an index of an unused element in fPool.  With a memory budget, the pool may hold more clusters
+   /// than its initial size, in which case a new slot is appended.
+   size_t FindFreeSlot();
+   /// Returns the uncompressed size of the given columns in the given cluster according to the descriptor, i.e. the
+   /// memory taken by the cluster's pages once they are unzipped
+   std::size_t GetClusterSize(DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns);
+   /// Returns the next cluster in entry order that should be preloaded, skipping the clusters outside the entry ranges
+   /// given in the read options
+   DescriptorId_t FindNextClusterId(DescriptorId_t clusterId);
+   /// Updates the processing time and, for an adaptive pool, resizes the look-ahead window.  Called by GetCluster()
+   /// when the main thread moves on to a new cluster.
+   void UpdateWindow(DescriptorId_t clusterId);
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
    /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
@@ -149,13 +186,15 @@ public:
 
    unsigned int GetWindowPre() const { return fWindowPre; }
    unsigned int GetWindowPost() const { return fWindowPost; }
+   unsigned int GetWindowAhead() const { return fWindowAhead; }
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of `columns`
-   /// and possibly pages of other columns, too.  If implicit multi-threading is turned on, the uncompressed pages
-   /// of the returned cluster are already pushed into the page pool associated with the page source upon return.
-   /// The cluster remains valid until the next call to GetCluster().
+   /// of the following fWindowAhead clusters or, given a memory budget, of the following clusters that fit in the
+   /// budget.  Clusters outside the entry ranges of the read options are skipped.  The returned cluster has at least
+   /// all the pages of `columns` and possibly pages of other columns, too.  If implicit multi-threading is turned on,
+   /// the uncompressed pages of the returned cluster are already pushed into the page pool associated with the page
+   /// source upon return.  The cluster remains valid until the next call to GetCluster().
    RCluster *GetCluster(DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns);
 }; // class RClusterPool
 
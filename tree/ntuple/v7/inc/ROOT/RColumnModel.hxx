@@ -31,6 +31,7 @@ namespace Experimental {
 
 More complex types, such as classes, get translated into columns of such simple types by the RField.
 New types need to be accounted for in RColumnElementBase::Generate() and RColumnElementBase::GetBitsOnStorage(), too.
+The numerical values are stored on disk, so new types need to be appended at the end.
 */
 // clang-format on
 enum class EColumnType {
@@ -49,6 +50,15 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // Split encodings: the bytes of the elements of a page are stored interleaved, i.e. first all the least
+   // significant bytes, then all the second bytes and so on, which usually compresses better. On top of that,
+   // kSplitIndex stores the differences between consecutive offsets and kSplitInt64/32 store zigzag encoded values
+   // in order to cluster small magnitudes in few byte planes.
+   kSplitIndex,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
 };
 
 // clang-format off
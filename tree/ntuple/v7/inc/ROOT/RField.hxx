@@ -623,9 +623,15 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Whether the values are written as IEEE 754 half precision numbers
+   bool fIsHalfPrecision = false;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fIsHalfPrecision = fIsHalfPrecision;
+      return clone;
    }
 
 public:
@@ -639,6 +645,12 @@ public:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
+   /// Store the values in a kReal16 column, which halves the size on disk but is lossy: the relative precision
+   /// drops to about 1e-3, and values beyond +-65504 become infinite. Needs to be set before the field is connected
+   /// to a page sink. Reading transparently accepts both kReal32 and kReal16 columns.
+   void SetHalfPrecision() { fIsHalfPrecision = true; }
+   bool IsHalfPrecision() const { return fIsHalfPrecision; }
+
    float *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<float>(globalIndex);
    }
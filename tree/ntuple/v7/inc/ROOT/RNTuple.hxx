@@ -26,10 +26,17 @@
 #include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <sstream>
+#include <thread>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -76,6 +83,47 @@ public:
 };
 #endif
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleThreadPoolTaskScheduler
+\ingroup NTuple
+\brief A task scheduler with a dedicated set of worker threads
+
+Used for decompressing pages in the background independently of whether or not implicit multi-threading is enabled.
+The thread calling Wait() helps processing the queued tasks.
+*/
+// clang-format on
+class RNTupleThreadPoolTaskScheduler : public Detail::RPageStorage::RTaskScheduler {
+private:
+   std::vector<std::thread> fWorkers;
+   /// Protects the task queue, the number of unfinished tasks, and the shutdown flag
+   std::mutex fLock;
+   /// Signals a non-empty task queue or a shutdown request to the workers
+   std::condition_variable fCvHasWork;
+   /// Signals that the last unfinished task of the current set of tasks is done
+   std::condition_variable fCvIsDone;
+   std::queue<std::function<void(void)>> fTasks;
+   /// Number of tasks of the current set that are queued or running
+   std::size_t fNUnfinished = 0;
+   bool fIsShutdown = false;
+
+   /// Worker thread routine
+   void ExecTasks();
+   /// Runs a task taken from the queue and decrements the number of unfinished tasks afterwards
+   void RunTask(std::function<void(void)> &task, std::unique_lock<std::mutex> &lock);
+
+public:
+   explicit RNTupleThreadPoolTaskScheduler(unsigned int nThreads);
+   RNTupleThreadPoolTaskScheduler(const RNTupleThreadPoolTaskScheduler &other) = delete;
+   RNTupleThreadPoolTaskScheduler &operator=(const RNTupleThreadPoolTaskScheduler &other) = delete;
+   virtual ~RNTupleThreadPoolTaskScheduler();
+   void Reset() final;
+   void AddTask(const std::function<void(void)> &taskFunc) final;
+   void Wait() final;
+
+   std::size_t GetNThreads() const { return fWorkers.size(); }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RNTupleReader
@@ -90,7 +138,8 @@ Individual fields can be read as well by instantiating a tree view.
 // clang-format on
 class RNTupleReader {
 private:
-   /// Set as the page source's scheduler for parallel page decompression if IMT is on
+   /// Set as the page source's scheduler for parallel page decompression if the read options request dedicated
+   /// unzip threads or if IMT is on.
    /// Needs to be destructed after the pages source is destructed (an thus be declared before)
    std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fUnzipTasks;
 
@@ -198,6 +247,13 @@ public:
    }
 
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
+   /// Returns the entry ranges in which the values of the given field may lie within [min, max], based on the value
+   /// statistics recorded at write time (see RNTupleDescriptor::FindEntryRanges()).  Entries outside the ranges
+   /// certainly fail the selection; entries inside the ranges still need to be checked one by one.  In order to
+   /// also skip reading the pruned clusters, pass the ranges to RNTupleReadOptions::SetEntryRanges().
+   ///
+   /// Raises an exception if there is no field with the given name.
+   std::vector<RNTupleReadOptions::REntryRange> FindEntryRanges(std::string_view fieldName, double min, double max);
 
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
@@ -247,6 +303,9 @@ triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception
 // clang-format on
 class RNTupleWriter {
 private:
+   /// Set as the page sink's scheduler for parallel page compression if IMT is on
+   /// Needs to be destructed after the page sink is destructed and so declared before
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
@@ -178,6 +178,32 @@ public:
       }
    };
 
+   /// The range of the values of the elements of a page or of a column in a cluster.  It is recorded at write time
+   /// for columns of arithmetic type and allows for skipping data that cannot satisfy a selection.  For the index
+   /// columns of collections, the range refers to the collection sizes rather than to the offsets.  64bit integers
+   /// are widened to the enclosing doubles.  If fIsValid is false, no statistics are available.
+   struct RValueRange {
+      bool fIsValid = false;
+      double fMin = 0;
+      double fMax = 0;
+
+      bool operator==(const RValueRange &other) const {
+         return fIsValid == other.fIsValid && (!fIsValid || (fMin == other.fMin && fMax == other.fMax));
+      }
+
+      /// Extends the range by the values of other; if either range has no statistics, the result has none either
+      void Merge(const RValueRange &other) {
+         if (!fIsValid || !other.fIsValid) {
+            *this = RValueRange();
+            return;
+         }
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+      /// Whether any of the values may lie within [min, max]; always true if there are no statistics
+      bool Overlaps(double min, double max) const { return !fIsValid || (fMin <= max && fMax >= min); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -188,13 +214,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The range of the values of all the pages of the column in the cluster
+      RValueRange fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -211,9 +237,10 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RLocator fLocator;
+         RValueRange fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
 
@@ -481,9 +508,13 @@ public:
       RIterator end() { return RIterator(fNTuple, fNTuple.GetNClusters()); }
    };
 
-   /// In order to handle changes to the serialization routine in future ntuple versions
-   static constexpr std::uint16_t kFrameVersionCurrent = 0;
+   /// In order to handle changes to the serialization routine in future ntuple versions.
+   /// Version 1 adds the value ranges of column ranges and pages to the footer.  The header is unchanged.  A footer
+   /// is written in version 1 only if it contains value ranges; since they cannot be skipped by readers of version 0,
+   /// such a footer requires kFrameVersionMinFooterRanges.
+   static constexpr std::uint16_t kFrameVersionCurrent = 1;
    static constexpr std::uint16_t kFrameVersionMin = 0;
+   static constexpr std::uint16_t kFrameVersionMinFooterRanges = 1;
    /// The preamble is sufficient to get the length of the header
    static constexpr unsigned int kNBytesPreamble = 8;
    /// The last few bytes after the footer store the length of footer and header
@@ -592,6 +623,11 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the entry ranges, in ascending order, in which the values of the given field may lie within
+   /// [min, max] according to the value ranges of its principal column.  For collections, the values are the
+   /// collection sizes.  Top-level fields are pruned at the granularity of pages, nested fields at the granularity of
+   /// clusters.  Data without statistics is always selected.
+   std::vector<REntryRange> FindEntryRanges(DescriptorId_t fieldId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
@@ -16,9 +16,14 @@
 #ifndef ROOT7_RNTupleMerger
 #define ROOT7_RNTupleMerger
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +43,43 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several ntuples with identical schema into a single destination
+
+The merger copies the sealed pages, i.e. the packed and compressed bytes as found on storage, from the sources to the
+destination.  Pages are neither unpacked nor decompressed if the compression settings of the source cluster match the
+compression settings of the destination.  Otherwise, the pages are recompressed but still not unpacked.
+The clustering of the sources is preserved.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Maps the column ids of the destination to the corresponding column ids of a source
+   struct RColumnInfo {
+      DescriptorId_t fSourceId = kInvalidDescriptorId;
+      DescriptorId_t fDestinationId = kInvalidDescriptorId;
+      /// Needed to calculate the packed size of a source page in case it needs to be recompressed
+      std::size_t fBitsOnStorage = 0;
+      /// Only set if the source column uses a different encoding than the destination column, e.g. a split encoding
+      std::unique_ptr<Detail::RColumnElementBase> fSourceElement;
+      std::unique_ptr<Detail::RColumnElementBase> fDestinationElement;
+   };
+
+   /// Finds the columns in the source that correspond to the columns of the already created destination.
+   /// Throws an exception if the source does not have the same schema as the destination.  Columns whose types
+   /// differ only in the encoding, such as kReal32 and kSplitReal32, are compatible; their pages get re-encoded.
+   static std::vector<RColumnInfo>
+   CollectColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination);
+
+public:
+   /// Merge the given sources into the destination.  The sources must not be attached yet; the destination
+   /// must not be created yet.  Its schema is derived from the first source.  Throws an RException on failure.
+   void Merge(const std::vector<Detail::RPageSource *> &sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
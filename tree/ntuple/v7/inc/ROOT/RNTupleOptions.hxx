@@ -19,6 +19,9 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
+#include <vector>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -50,6 +53,15 @@ class RNTupleWriteOptions {
    NTupleSize_t fNEntriesPerCluster = 64000;
    NTupleSize_t fNElementsPerPage = 10000;
    bool fUseBufferedWrite = true;
+   /// If set, columns of type kIndex, kReal64/32, and kInt64/32 are stored with their split encodings, which
+   /// typically compress better at a small cost of packing and unpacking the pages
+   bool fUseSplitEncoding = false;
+   /// If set, page buffers are taken from a recycling RPageAllocatorArena instead of being allocated one by one
+   bool fUsePageArena = false;
+   /// If set, the page sink records the value range of every page and column range of arithmetic columns, which
+   /// allows for pruning entry ranges on reading.  Otherwise, the footer is written without value ranges and remains
+   /// readable by older versions.
+   bool fUsePageStatistics = true;
 
 public:
    int GetCompression() const { return fCompression; }
@@ -69,6 +81,15 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+   void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+
+   bool GetUsePageArena() const { return fUsePageArena; }
+   void SetUsePageArena(bool val) { fUsePageArena = val; }
+
+   bool GetUsePageStatistics() const { return fUsePageStatistics; }
+   void SetUsePageStatistics(bool val) { fUsePageStatistics = val; }
 };
 
 
@@ -89,12 +110,52 @@ public:
       kDefault = kOn,
    };
 
+   using REntryRange = ROOT::Experimental::REntryRange;
+
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   /// Upper limit for the uncompressed size of the requested columns of the clusters in the cluster cache's
+   /// look-ahead window. If zero, the look-ahead window is bounded by a fixed number of clusters.
+   std::size_t fClusterCacheMemoryBudget = 0;
+   /// If set, the cluster cache shrinks or grows the look-ahead window such that clusters arrive just in time
+   /// given the observed read, unzip, and processing times.  Clusters that are already loaded or scheduled are
+   /// not discarded when the window shrinks.
+   bool fUseAdaptiveClusterWindow = false;
+   /// If not empty, only clusters containing entries of these ranges are preloaded by the cluster cache
+   std::vector<REntryRange> fEntryRanges;
+   /// If non-zero, a dedicated pool of threads decompresses the pages of the preloaded clusters in the background,
+   /// independently of implicit multi-threading.  Otherwise, pages are decompressed in the background by the IMT
+   /// thread pool if IMT is enabled, or else on demand by the reading thread.
+   unsigned int fNUnzipThreads = 0;
+   /// If set, page and cluster buffers are taken from a recycling RPageAllocatorArena instead of being allocated
+   /// one by one
+   bool fUsePageArena = false;
+   /// If set and the storage supports memory mapping (e.g. local files), the file is mapped into memory instead of
+   /// being read.  Pages of uncompressed columns whose on-disk layout matches the memory layout then point directly
+   /// into the mapping without being copied.
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+
+   std::size_t GetClusterCacheMemoryBudget() const { return fClusterCacheMemoryBudget; }
+   void SetClusterCacheMemoryBudget(std::size_t val) { fClusterCacheMemoryBudget = val; }
+
+   bool GetUseAdaptiveClusterWindow() const { return fUseAdaptiveClusterWindow; }
+   void SetUseAdaptiveClusterWindow(bool val) { fUseAdaptiveClusterWindow = val; }
+
+   const std::vector<REntryRange> &GetEntryRanges() const { return fEntryRanges; }
+   void SetEntryRanges(const std::vector<REntryRange> &val) { fEntryRanges = val; }
+
+   unsigned int GetNUnzipThreads() const { return fNUnzipThreads; }
+   void SetNUnzipThreads(unsigned int val) { fNUnzipThreads = val; }
+
+   bool GetUsePageArena() const { return fUsePageArena; }
+   void SetUsePageArena(bool val) { fUsePageArena = val; }
+
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
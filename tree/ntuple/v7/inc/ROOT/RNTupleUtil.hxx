@@ -135,6 +135,12 @@ public:
    ClusterSize_t::ValueType GetIndex() const { return fIndex; }
 };
 
+/// The entries [fFirstEntry, fFirstEntry + fNEntries)
+struct REntryRange {
+   NTupleSize_t fFirstEntry = 0;
+   NTupleSize_t fNEntries = 0;
+};
+
 /// Every NTuple is identified by a UUID.  TODO(jblomer): should this be a TUUID?
 using RNTupleUuid = std::string;
 
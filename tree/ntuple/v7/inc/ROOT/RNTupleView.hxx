@@ -18,8 +18,11 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -145,7 +148,9 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields,
+MapBulk() returns a span over a contiguous range of entries, which points directly into the page buffer if the range
+is contained in a single page and into a view-owned buffer otherwise.
 */
 // clang-format on
 template <typename T>
@@ -160,6 +165,9 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    Detail::RFieldValue fValue;
+   /// Used by MapBulk() to gather ranges that span several pages
+   std::unique_ptr<T[]> fBulkBuffer;
+   std::size_t fBulkCapacity = 0;
 
    RNTupleView(DescriptorId_t fieldId, Detail::RPageSource* pageSource)
      : fField(pageSource->GetDescriptor().GetFieldDescriptor(fieldId).GetFieldName()), fValue(fField.GenerateValue())
@@ -215,6 +223,32 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Returns the values of the entries [globalIndex, globalIndex + nItems).  If the range is contained in a single
+   /// page, the span points into the page buffer; otherwise the values are copied page by page into a buffer owned by
+   /// the view.  The span is valid until the next read through this view.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapBulk(NTupleSize_t globalIndex, NTupleSize_t nItems) {
+      if (nItems == 0)
+         return std::span<const C>();
+      NTupleSize_t nPageItems;
+      const C *values = fField.MapV(globalIndex, nPageItems);
+      if (nPageItems >= nItems)
+         return std::span<const C>(values, nItems);
+
+      if (fBulkCapacity < nItems) {
+         fBulkBuffer = std::unique_ptr<T[]>(new T[nItems]);
+         fBulkCapacity = nItems;
+      }
+      std::copy(values, values + nPageItems, fBulkBuffer.get());
+      for (NTupleSize_t i = nPageItems; i < nItems; i += nPageItems) {
+         values = fField.MapV(globalIndex + i, nPageItems);
+         nPageItems = std::min(nPageItems, nItems - i);
+         std::copy(values, values + nPageItems, fBulkBuffer.get() + i);
+      }
+      return std::span<const C>(fBulkBuffer.get(), nItems);
+   }
 };
 
 
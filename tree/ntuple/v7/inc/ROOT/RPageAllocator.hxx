@@ -16,11 +16,16 @@
 #ifndef ROOT7_RPageAllocator
 #define ROOT7_RPageAllocator
 
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +82,68 @@ public:
    static void DeletePage(const RPage &page);
 };
 
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageAllocatorArena
+\ingroup NTuple
+\brief Recycles the memory of released page and cluster buffers
+
+Buffer sizes are rounded up to a size class; the rounding wastes less than 25% of the buffer.  Released buffers are
+kept on a free list per size class and handed out again for requests of the same size class.  Up to a configurable
+number of bytes are retained; beyond that, released buffers are freed.  The arena is thread-safe.  Because page
+buffers may outlive the page storage, the arena is shared by the page storage and the deleters of its pages.
+*/
+// clang-format on
+class RPageAllocatorArena {
+public:
+   static constexpr std::size_t kDefaultMaxRetained = 256 * 1024 * 1024;
+   /// The smallest size class
+   static constexpr std::size_t kMinBlockSize = 64;
+
+private:
+   /// Memory usage counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fSzAllocated;
+      RNTupleAtomicCounter &fSzReused;
+      RNTupleAtomicCounter &fNAllocated;
+      RNTupleAtomicCounter &fNReused;
+   };
+   std::unique_ptr<RCounters> fCounters;
+   RNTupleMetrics fMetrics;
+
+   /// Upper limit of the total size of the buffers on the free lists
+   std::size_t fMaxRetained;
+   /// Protects the free lists and fSzRetained
+   std::mutex fLock;
+   /// Maps the size class to the released buffers of that size
+   std::unordered_map<std::size_t, std::vector<unsigned char *>> fFreeLists;
+   /// The total size of the buffers on the free lists
+   std::size_t fSzRetained = 0;
+
+public:
+   explicit RPageAllocatorArena(std::size_t maxRetained = kDefaultMaxRetained);
+   RPageAllocatorArena(const RPageAllocatorArena &other) = delete;
+   RPageAllocatorArena &operator=(const RPageAllocatorArena &other) = delete;
+   ~RPageAllocatorArena();
+
+   /// Rounds up nbytes to the next size class
+   static std::size_t GetBlockSize(std::size_t nbytes);
+
+   /// Returns a buffer of at least nbytes, preferably a recycled one
+   unsigned char *Allocate(std::size_t nbytes);
+   /// Takes back a buffer returned by Allocate(nbytes) for recycling
+   void Release(void *buffer, std::size_t nbytes);
+
+   /// Like RPageAllocatorHeap::NewPage() but the page memory is taken from the arena
+   RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements);
+   /// Returns the memory of a page created by NewPage() to the arena
+   void DeletePage(const RPage &page) { Release(page.GetBuffer(), page.GetCapacity()); }
+
+   std::size_t GetSzRetained();
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
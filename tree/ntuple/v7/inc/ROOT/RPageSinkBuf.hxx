@@ -17,9 +17,14 @@
 #ifndef ROOT7_RPageSinkBuf
 #define ROOT7_RPageSinkBuf
 
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <algorithm>
+#include <deque>
 #include <memory>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -30,31 +35,89 @@ namespace Detail {
 \class ROOT::Experimental::Detail::RPageSinkBuf
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
+
+If a task scheduler is set, the buffered pages are sealed (packed and compressed) concurrently as soon as they are
+committed.  On CommitCluster(), the sink waits for the outstanding tasks and hands the sealed pages over to the
+inner sink ordered by column and page number, so that the on-disk layout does not depend on the order in which
+the tasks finished.
 */
 // clang-format on
 class RPageSinkBuf : public RPageSink {
 private:
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fParallelZip;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuZip;
+      /// Wall clock time spent in sealing the pages of the individual columns; indexed by column id
+      std::vector<RNTupleAtomicCounter *> fTimeWallZipColumns;
+   };
+
    /// A buffered column. The column is not responsible for RPage memory management (i.e.
    /// ReservePage/ReleasePage), which is handled by the enclosing RPageSinkBuf.
    class RColumnBuf {
+   public:
+      /// Compression scratch buffer of a sealed page
+      struct RSealedPageBuf {
+         std::unique_ptr<unsigned char[]> fBuffer;
+         std::size_t fSize = 0;
+      };
+      struct RPageZipItem {
+         RPage fPage;
+         RSealedPageBuf fBuf;
+         RPageStorage::RSealedPage fSealedPage;
+         explicit RPageZipItem(RPage page) : fPage(page) {}
+      };
+      /// A deque keeps the references to the zip items stable while sealing tasks are in flight
+      using ZipItems_t = std::deque<RPageZipItem>;
+
    private:
-      std::pair<RPageStorage::ColumnHandle_t, std::vector<RPage>> fBuf;
+      RPageStorage::ColumnHandle_t fHandle;
+      ZipItems_t fBufferedPages;
+      /// Scratch buffers of the sealed pages that have been handed over to the inner sink, to be reused by the
+      /// pages of the following clusters.  Only accessed by the thread that commits pages and clusters.
+      std::vector<RSealedPageBuf> fFreeBufs;
+
    public:
-      void BufferPage(RPageStorage::ColumnHandle_t columnHandle, const RPage &page) {
-         if (!fBuf.first) {
-            fBuf.first = columnHandle;
+      /// The scratch buffer needs to hold the packed page, which can be larger or smaller than the page in memory.
+      /// Pages of a column are usually of the same size, so a recycled buffer fits unless it belonged to a tail page.
+      void AllocateSealedPageBuf(RPageZipItem &zipItem, const RColumnElementBase &element) {
+         const std::size_t nBytes = std::max(element.GetPackedSize(zipItem.fPage.GetNElements()),
+                                             static_cast<std::size_t>(zipItem.fPage.GetSize()));
+         if (!fFreeBufs.empty()) {
+            if (fFreeBufs.back().fSize >= nBytes)
+               zipItem.fBuf = std::move(fFreeBufs.back());
+            fFreeBufs.pop_back();
+            if (zipItem.fBuf.fBuffer)
+               return;
+         }
+         zipItem.fBuf.fBuffer = std::make_unique<unsigned char[]>(nBytes);
+         zipItem.fBuf.fSize = nBytes;
+      }
+      void RecycleSealedPageBuf(RPageZipItem &zipItem) {
+         if (zipItem.fBuf.fBuffer)
+            fFreeBufs.emplace_back(std::move(zipItem.fBuf));
+      }
+
+      RPageZipItem &BufferPage(RPageStorage::ColumnHandle_t columnHandle, const RPage &page) {
+         if (!fHandle) {
+            fHandle = columnHandle;
          }
-         fBuf.second.push_back(page);
+         fBufferedPages.emplace_back(page);
+         return fBufferedPages.back();
       }
-      const RPageStorage::ColumnHandle_t &GetHandle() const { return fBuf.first; }
-      std::vector<RPage> DrainBufferedPages() {
-         std::vector<RPage> drained;
-         std::swap(fBuf.second, drained);
+      const RPageStorage::ColumnHandle_t &GetHandle() const { return fHandle; }
+      ZipItems_t DrainBufferedPages() {
+         ZipItems_t drained;
+         std::swap(fBufferedPages, drained);
          return drained;
       }
    };
 
 private:
+   std::unique_ptr<RCounters> fCounters;
+   /// The counters of the buffered sink.  The metrics of the inner sink are kept separate, so that an RNTupleWriter
+   /// can expose them under the same path as for an unbuffered sink.
+   RNTupleMetrics fMetrics;
    /// The inner sink, responsible for actually performing I/O.
    std::unique_ptr<RPageSink> fInnerSink;
    /// The buffered page sink maintains a copy of the RNTupleModel for the inner sink.
@@ -81,7 +144,8 @@ public:
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
    void ReleasePage(RPage &page) final;
 
-   RNTupleMetrics &GetMetrics() final { return fInnerSink->GetMetrics(); }
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+   RNTupleMetrics &GetInnerMetrics() { return fInnerSink->GetMetrics(); }
 };
 
 } // namespace Detail
@@ -28,6 +28,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -83,8 +84,12 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// The value statistics of the page elements, if known.  Sealed pages lose the in-memory representation,
+      /// so the statistics need to be carried along with the page.
+      RClusterDescriptor::RValueRange fValueRange;
 
       RSealedPage() = default;
+      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
       RSealedPage(const RSealedPage &other) = delete;
       RSealedPage& operator =(const RSealedPage &other) = delete;
       RSealedPage(RSealedPage &&other) = default;
@@ -166,6 +171,11 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Computes the value range of a committed page; the second argument keeps the last offset of index columns
+   /// in the currently open cluster. Indexed by column id, nullptr for columns without value statistics.
+   using ValueRangeFunc_t = RClusterDescriptor::RValueRange (*)(const RPage &, std::uint64_t &);
+   std::vector<ValueRangeFunc_t> fValueRangeFuncs;
+   std::vector<std::uint64_t> fOpenLastOffsets;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
@@ -182,6 +192,16 @@ protected:
    /// Usage of this method requires construction of fCompressor.
    RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting);
 
+   /// Seal a page using the provided buffer, which must be large enough to hold the packed page.  Unlike the member
+   /// function above, this version does not use fCompressor and can thus be called concurrently, e.g. from the
+   /// tasks of a task scheduler.  As above, an uncompressed, mappable page results in a sealed page that points to
+   /// the input page buffer.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting,
+                               void *buf);
+
+   /// Adds a committed page to the page range and the column range of the currently open cluster
+   void AddPageInfo(DescriptorId_t columnId, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo);
+
 public:
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
@@ -197,6 +217,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// Returns the descriptor of the ntuple as written so far, i.e. the schema after Create() and the committed clusters
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -234,6 +256,11 @@ class RPageSource : public RPageStorage {
 public:
    /// Derived from the model (fields) that are actually being requested at a given point in time
    using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+   /// The identifiers that specify the content of a (partial) cluster
+   struct RClusterKey {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      ColumnSet_t fColumns;
+   };
 
 protected:
    RNTupleReadOptions fOptions;
@@ -256,6 +283,9 @@ protected:
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor.
    std::unique_ptr<unsigned char []> UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Like UnsealPage() but writes the unsealed page into the provided buffer, which needs to have space for
+   /// the unpacked elements of the page.
+   void UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, unsigned char *pageBuffer);
 
 public:
    RPageSource(std::string_view ntupleName, const RNTupleReadOptions &fOptions);
@@ -273,6 +303,9 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleDescriptor &GetDescriptor() const { return fDescriptor; }
    const RNTupleReadOptions &GetReadOptions() const { return fOptions; }
+   /// Restricts the clusters preloaded by the cluster cache to the given entry ranges, as if the ranges were set
+   /// in the read options.  Needs to be called before the first cluster is requested.
+   void SetEntryRanges(const std::vector<RNTupleReadOptions::REntryRange> &ranges) { fOptions.SetEntryRanges(ranges); }
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) override;
    void DropColumn(ColumnHandle_t columnHandle) override;
 
@@ -302,6 +335,10 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Populates the pages of several (cluster, columns) pairs in one go.  Page sources that can batch the I/O of
+   /// multiple clusters, e.g. into a single vector read, should override this method.  The default implementation
+   /// calls LoadCluster() for every key in turn.  The returned clusters are in the order of `clusterKeys`.
+   virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterKey> &clusterKeys);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
@@ -27,19 +28,16 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
 namespace ROOT {
-
-namespace Internal {
-class RRawFile;
-}
-
 namespace Experimental {
 namespace Detail {
 
 class RClusterPool;
+class RPageAllocatorArena;
 class RPageAllocatorHeap;
 class RPagePool;
 
@@ -62,6 +60,8 @@ private:
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
    std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   /// Set if the write options request a recycling page arena; used instead of fPageAllocator
+   std::shared_ptr<RPageAllocatorArena> fPageArena;
 
    std::unique_ptr<Internal::RNTupleFileWriter> fWriter;
    /// Byte offset of the first page of the current cluster
@@ -133,6 +133,7 @@ private:
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTupleAtomicCounter &fNPageLoaded;
       RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageMapped;
       RNTupleAtomicCounter &fTimeWallRead;
       RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
@@ -149,12 +150,19 @@ private:
 
    /// Populated pages might be shared; there memory buffer is managed by the RPageAllocatorFile
    std::unique_ptr<RPageAllocatorFile> fPageAllocator;
+   /// Set if the read options request a recycling page arena.  It provides the page buffers as well as the
+   /// memory of the loaded clusters.  Shared with the page deleters and the clusters' page maps.
+   std::shared_ptr<RPageAllocatorArena> fPageArena;
    /// The page pool might, at some point, be used by multiple page sources
    std::shared_ptr<RPagePool> fPagePool;
    /// The last cluster from which a page got populated.  Points into fClusterPool->fPool
    RCluster *fCurrentCluster = nullptr;
-   /// An RRawFile is used to request the necessary byte ranges from a local or a remote file
-   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   /// An RRawFile is used to request the necessary byte ranges from a local or a remote file.  Shared with the
+   /// deleter of the file mapping, which can outlive the page source.
+   std::shared_ptr<ROOT::Internal::RRawFile> fFile;
+   /// Set if the read options request memory mapping and the raw file supports it.  Maps the entire file read-only.
+   /// Shared by the clusters of the cluster pool and by the pages that point directly into the mapping.
+   std::shared_ptr<const unsigned char> fFileMapping;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
    /// The cluster pool asynchronously preloads the next few clusters
@@ -163,6 +171,25 @@ private:
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Unseals the page into a new buffer, which is taken from the page arena if there is one
+   unsigned char *UnsealPageToNewBuffer(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Returns the deleter the page pool uses to free the buffers returned by UnsealPageToNewBuffer()
+   RPageDeleter MakePageDeleter() const;
+   /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the read requests for a given
+   /// cluster and columns.  The read requests are appended to the provided vector.  This way, requests can be
+   /// collected for multiple clusters before sending them to RRawFile::ReadV().
+   std::unique_ptr<RCluster>
+   PrepareSingleCluster(const RClusterKey &clusterKey, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Used instead of PrepareSingleCluster if the file is memory mapped: the on-disk pages point into fFileMapping
+   std::unique_ptr<RCluster> PrepareMappedCluster(const RClusterKey &clusterKey);
+   /// Whether the sealed page can be used as is, i.e. it is neither compressed nor packed and properly aligned.
+   /// Only pages located in the file mapping are passed here.
+   static bool IsMappedPage(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Returns the deleter for pages that point into fFileMapping; it keeps the mapping alive as long as the page
+   RPageDeleter MakeMappedPageDeleter() const;
+   /// Either points the new page into the mapping or unseals the sealed page into a new buffer
+   RPage MakePage(DescriptorId_t columnId, const RSealedPage &sealedPage, const RColumnElementBase &element,
+                  RPageDeleter &deleter);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -188,6 +215,7 @@ public:
                        RSealedPage &sealedPage) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RClusterKey> &clusterKeys) final;
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
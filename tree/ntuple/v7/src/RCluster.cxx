@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RPageAllocator.hxx>
 
 #include <TError.h>
 
@@ -33,6 +34,18 @@ ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = default;
 ////////////////////////////////////////////////////////////////////////////////
 
 
+ROOT::Experimental::Detail::ROnDiskPageMapMmap::~ROnDiskPageMapMmap() = default;
+
+
+ROOT::Experimental::Detail::ROnDiskPageMapArena::~ROnDiskPageMapArena()
+{
+   fArena->Release(fMemory, fSize);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 const ROOT::Experimental::Detail::ROnDiskPage *
 ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
 {
@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
@@ -24,6 +25,7 @@
 #include <future>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -47,8 +49,26 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterId < other.fClusterId;
 }
 
+namespace {
+
+/// Exponential moving average giving a weight of 1/4 to the new sample; the first sample initializes the average
+std::int64_t UpdateMovingAverage(std::int64_t average, std::int64_t sample)
+{
+   sample = std::max(sample, std::int64_t(1));
+   return (average == 0) ? sample : (3 * average + sample) / 4;
+}
+
+std::int64_t GetElapsedNs(std::chrono::steady_clock::time_point since)
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int size)
    : fPageSource(pageSource)
+   , fMemoryBudget(pageSource.GetReadOptions().GetClusterCacheMemoryBudget())
+   , fIsAdaptive(pageSource.GetReadOptions().GetUseAdaptiveClusterWindow())
    , fPool(size)
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
@@ -61,6 +81,7 @@ ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource,
       fWindowPre++;
       fWindowPost--;
    }
+   fWindowAhead = fWindowPost;
 }
 
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
@@ -99,7 +120,9 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          if (!item.fCluster)
             return;
 
+         auto timeStart = std::chrono::steady_clock::now();
          fPageSource.UnzipCluster(item.fCluster.get());
+         fTimeUnzipNs.store(UpdateMovingAverage(fTimeUnzipNs.load(), GetElapsedNs(timeStart)));
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
          item.fPromise.set_value(std::move(item.fCluster));
@@ -120,12 +143,30 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
-      for (auto &item : readItems) {
-         if (item.fClusterId == kInvalidDescriptorId)
-            return;
+      // The page source loads all the clusters queued so far in one go; a shutdown request (invalid cluster id)
+      // ends the batch.  Clusters queued before the shutdown request are still handed over.
+      std::vector<RPageSource::RClusterKey> clusterKeys;
+      bool isTerminated = false;
+      for (const auto &item : readItems) {
+         if (item.fClusterId == kInvalidDescriptorId) {
+            isTerminated = true;
+            break;
+         }
+         RPageSource::RClusterKey key;
+         key.fClusterId = item.fClusterId;
+         key.fColumns = item.fColumns;
+         clusterKeys.emplace_back(std::move(key));
+      }
+      auto timeStart = std::chrono::steady_clock::now();
+      auto clusters = fPageSource.LoadClusters(clusterKeys);
+      if (!clusters.empty()) {
+         fTimeReadNs.store(
+            UpdateMovingAverage(fTimeReadNs.load(), GetElapsedNs(timeStart) / std::int64_t(clusters.size())));
+      }
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
-         auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         auto &item = readItems[i];
+         auto &cluster = clusters[i];
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -149,6 +190,9 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             fCvHasUnzipWork.notify_one();
          }
       }
+
+      if (isTerminated)
+         return;
    } // while (true)
 }
 
@@ -162,7 +206,7 @@ ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) c
    return nullptr;
 }
 
-size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
+size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot()
 {
    auto N = fPool.size();
    for (unsigned i = 0; i < N; ++i) {
@@ -170,11 +214,85 @@ size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
          return i;
    }
 
-   R__ASSERT(false);
+   // Only a memory budgeted window can exceed the number of clusters the pool was created for
+   R__ASSERT(fMemoryBudget > 0);
+   fPool.emplace_back(nullptr);
    return N;
 }
 
 
+std::size_t ROOT::Experimental::Detail::RClusterPool::GetClusterSize(
+   DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns)
+{
+   const auto &desc = fPageSource.GetDescriptor();
+   const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+   std::size_t size = 0;
+   for (auto columnId : columns) {
+      if (!clusterDesc.ContainsColumn(columnId))
+         continue;
+      auto itrElementSize = fElementSizes.find(columnId);
+      if (itrElementSize == fElementSizes.end()) {
+         const auto columnType = desc.GetColumnDescriptor(columnId).GetModel().GetType();
+         itrElementSize =
+            fElementSizes.emplace(columnId, RColumnElementBase::Generate(columnType)->GetSize()).first;
+      }
+      size += clusterDesc.GetColumnRange(columnId).fNElements * itrElementSize->second;
+   }
+   return size;
+}
+
+
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::Detail::RClusterPool::FindNextClusterId(DescriptorId_t clusterId)
+{
+   const auto &desc = fPageSource.GetDescriptor();
+   const auto &entryRanges = fPageSource.GetReadOptions().GetEntryRanges();
+   if (entryRanges.empty())
+      return desc.FindNextClusterId(clusterId);
+
+   if (!fIsSelectionInitialized) {
+      for (const auto &clusterDesc : desc.GetClusterIterable()) {
+         auto first = clusterDesc.GetFirstEntryIndex();
+         auto last = first + clusterDesc.GetNEntries();
+         for (const auto &range : entryRanges) {
+            if ((range.fFirstEntry < last) && (first < range.fFirstEntry + range.fNEntries)) {
+               fSelectedClusters[first] = clusterDesc.GetId();
+               break;
+            }
+         }
+      }
+      fIsSelectionInitialized = true;
+   }
+
+   auto itr = fSelectedClusters.upper_bound(desc.GetClusterDescriptor(clusterId).GetFirstEntryIndex());
+   return (itr == fSelectedClusters.end()) ? kInvalidDescriptorId : itr->second;
+}
+
+
+void ROOT::Experimental::Detail::RClusterPool::UpdateWindow(DescriptorId_t clusterId)
+{
+   if (clusterId == fLastClusterId)
+      return;
+   if (fLastClusterId != kInvalidDescriptorId)
+      fTimeProcessNs = UpdateMovingAverage(fTimeProcessNs, GetElapsedNs(fLastClusterTime));
+   fLastClusterId = clusterId;
+
+   const auto timeLoadNs = fTimeReadNs.load() + fTimeUnzipNs.load();
+   if (!fIsAdaptive || (fTimeProcessNs == 0) || (timeLoadNs == 0))
+      return;
+
+   // While a cluster is being loaded, the main thread keeps processing the clusters before it in the window.
+   // In order to hide the load latency, the window thus needs to span the clusters processed during the load time.
+   // The look-ahead is at least one (the requested cluster) and at most the number of clusters in the ntuple.
+   // Without a memory budget, it is also bounded by the size of the pool.
+   std::int64_t nAhead = 1 + (timeLoadNs + fTimeProcessNs - 1) / fTimeProcessNs;
+   nAhead = std::min(nAhead, std::int64_t(fPageSource.GetDescriptor().GetNClusters()));
+   if (fMemoryBudget == 0)
+      nAhead = std::min(nAhead, std::int64_t(fWindowPost));
+   fWindowAhead = std::max(nAhead, std::int64_t(1));
+}
+
+
 namespace {
 
 /// Helper class for the (cluster, column list) pairs that should be loaded in the background
@@ -221,29 +339,75 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
    DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns)
 {
    const auto &desc = fPageSource.GetDescriptor();
+   UpdateWindow(clusterId);
 
-   // Determine previous cluster ids that we keep if they happen to be in the pool
+   // The clusters in the pool that are kept in addition to the ones provided
    std::set<DescriptorId_t> keep;
-   auto prev = clusterId;
-   for (unsigned int i = 0; i < fWindowPre; ++i) {
-      prev = desc.FindPrevClusterId(prev);
-      if (prev == kInvalidDescriptorId)
-         break;
-      keep.insert(prev);
-   }
 
-   // Determine following cluster ids and the column ids that we want to make available
+   // Determine following cluster ids and the column ids that we want to make available.  The requested cluster
+   // is always provided.  Following clusters are added as long as the window has room for them, which is given
+   // by the number of clusters in the window and, if set, by the memory budget.
    RProvides provide;
    provide.Insert(clusterId, columns);
-   auto next = clusterId;
-   // TODO(jblomer): instead of a fixed-sized window, eventually we should determine the window size based on
-   // a user-defined memory limit.  The size of the preloaded data can be determined at the beginning of
-   // GetCluster from the descriptor and the current contents of fPool.
-   for (unsigned int i = 1; i < fWindowPost; ++i) {
-      next = desc.FindNextClusterId(next);
+   unsigned int windowAhead = fWindowAhead;
+   if ((fMemoryBudget > 0) && !fIsAdaptive)
+      windowAhead = std::numeric_limits<unsigned int>::max();
+   std::size_t szWindow = GetClusterSize(clusterId, columns);
+   auto last = clusterId;
+   for (unsigned int i = 1; i < windowAhead; ++i) {
+      auto next = FindNextClusterId(last);
       if (next == kInvalidDescriptorId)
          break;
+      if (fMemoryBudget > 0) {
+         szWindow += GetClusterSize(next, columns);
+         if (szWindow > fMemoryBudget)
+            break;
+      }
       provide.Insert(next, columns);
+      last = next;
+   }
+
+   // Hysteresis for the adaptive window: if the window shrank, the clusters following it that are already in the
+   // pool or in flight were scheduled by a previous, larger window.  They are kept (as long as the memory budget
+   // permits) rather than discarded, since otherwise they would be fetched a second time once the window grows again.
+   if (fIsAdaptive) {
+      std::set<DescriptorId_t> scheduled;
+      for (const auto &cptr : fPool) {
+         if (cptr)
+            scheduled.insert(cptr->GetId());
+      }
+      {
+         std::lock_guard<std::mutex> lockGuard(fLockWorkQueue);
+         for (const auto &inFlight : fInFlightClusters)
+            scheduled.insert(inFlight.fClusterId);
+      }
+      while (true) {
+         auto next = FindNextClusterId(last);
+         if ((next == kInvalidDescriptorId) || (scheduled.count(next) == 0))
+            break;
+         if (fMemoryBudget > 0) {
+            szWindow += GetClusterSize(next, columns);
+            if (szWindow > fMemoryBudget)
+               break;
+         }
+         keep.insert(next);
+         last = next;
+      }
+   }
+
+   // Determine previous cluster ids that we keep if they happen to be in the pool.  With a memory budget, they only
+   // take what the look-ahead window left of it.
+   auto prev = clusterId;
+   for (unsigned int i = 0; i < fWindowPre; ++i) {
+      prev = desc.FindPrevClusterId(prev);
+      if (prev == kInvalidDescriptorId)
+         break;
+      if ((fMemoryBudget > 0) && FindInPool(prev)) {
+         szWindow += GetClusterSize(prev, columns);
+         if (szWindow > fMemoryBudget)
+            break;
+      }
+      keep.insert(prev);
    }
 
    // Clear the cache from clusters not the in the look-ahead or the look-back window
@@ -326,7 +490,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          fCvHasReadWork.notify_one();
    } // work queue lock guard
 
-   return WaitFor(clusterId, columns);
+   auto result = WaitFor(clusterId, columns);
+   fLastClusterTime = std::chrono::steady_clock::now();
+   return result;
 }
 
 
@@ -15,6 +15,8 @@
 
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <TError.h>
@@ -45,12 +47,34 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    switch (pageStorage->GetType()) {
    case EPageStorageType::kSink:
       fPageSink = static_cast<RPageSink*>(pageStorage); // the page sink initializes fHeadPage on AddColumn
+      if (fPageSink->GetWriteOptions().GetUseSplitEncoding() && fElement->IsMappable()) {
+         // The split encoding packs pages of the same in-memory layout, so it can be swapped in transparently
+         auto splitType = RColumnElementBase::GetSplitType(fModel.GetType());
+         if (splitType != EColumnType::kUnknown) {
+            fModel = RColumnModel(splitType, fModel.GetIsSorted());
+            fElement = RColumnElementBase::Generate(splitType);
+         }
+      }
       fHandleSink = fPageSink->AddColumn(fieldId, *this);
       fHeadPage = fPageSink->ReservePage(fHandleSink);
       break;
    case EPageStorageType::kSource:
       fPageSource = static_cast<RPageSource*>(pageStorage);
       fHandleSource = fPageSource->AddColumn(fieldId, *this);
+      {
+         // The fields accept the split encoding of their column types, in which case the element is swapped
+         // for one that knows how to unpack the split pages
+         const auto onDiskType =
+            fPageSource->GetDescriptor().GetColumnDescriptor(fHandleSource.fId).GetModel().GetType();
+         if ((onDiskType != fModel.GetType()) && (RColumnElementBase::GetSplitType(fModel.GetType()) == onDiskType)) {
+            if (!fElement->IsMappable()) {
+               throw RException(R__FAIL("cannot convert split encoded column of type " +
+                                        RColumnElementBase::GetTypeName(onDiskType)));
+            }
+            fModel = RColumnModel(onDiskType, fModel.GetIsSorted());
+            fElement = RColumnElementBase::Generate(onDiskType);
+         }
+      }
       fNElements = fPageSource->GetNElements(fHandleSource);
       fColumnIdSource = fPageSource->GetColumnId(fHandleSource);
       break;
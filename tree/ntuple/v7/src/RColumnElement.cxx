@@ -20,9 +20,123 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Converts an IEEE 754 single precision number into a half precision number, rounding to the nearest even value.
+/// Numbers beyond the half precision range become infinity; NaNs stay NaNs.
+std::uint16_t FloatToHalf(float value)
+{
+   std::uint32_t f;
+   std::memcpy(&f, &value, sizeof(f));
+   const std::uint16_t sign = (f >> 16) & 0x8000;
+   const std::uint32_t absF = f & 0x7FFFFFFF;
+
+   if (absF >= 0x7F800000) {
+      // Inf or NaN, in the latter case make sure the mantissa remains non-zero
+      return sign | 0x7C00 | ((absF > 0x7F800000) ? (0x0200 | ((absF >> 13) & 0x03FF)) : 0);
+   }
+   // 65520 and larger rounds to infinity
+   if (absF >= 0x477FF000)
+      return sign | 0x7C00;
+   if (absF < 0x38800000) {
+      // Subnormal half precision number; values smaller or equal than 2^-25 round to zero
+      if (absF < 0x33000001)
+         return sign;
+      const std::uint32_t mantissa = (absF & 0x007FFFFF) | 0x00800000;
+      const unsigned int shift = 126 - (absF >> 23);
+      std::uint32_t half = mantissa >> shift;
+      const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+      const std::uint32_t halfway = 1u << (shift - 1);
+      if ((remainder > halfway) || ((remainder == halfway) && (half & 1)))
+         ++half;
+      return sign | half;
+   }
+
+   // Normal number: rebias the exponent from 127 to 15 and round the mantissa from 23 to 10 bits
+   std::uint32_t half = (absF >> 13) - ((127 - 15) << 10);
+   const std::uint32_t remainder = absF & 0x1FFF;
+   if ((remainder > 0x1000) || ((remainder == 0x1000) && (half & 1)))
+      ++half;
+   return sign | half;
+}
+
+/// Converts an IEEE 754 half precision number into a single precision number; the conversion is exact
+float HalfToFloat(std::uint16_t half)
+{
+   const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+   std::uint32_t exponent = (half >> 10) & 0x1F;
+   std::uint32_t mantissa = half & 0x03FF;
+
+   std::uint32_t f;
+   if (exponent == 0x1F) {
+      f = sign | 0x7F800000 | (mantissa << 13);
+   } else if (exponent != 0) {
+      f = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+   } else if (mantissa == 0) {
+      f = sign;
+   } else {
+      // Subnormal half precision number, becomes a normal single precision number
+      exponent = 127 - 14;
+      while ((mantissa & 0x0400) == 0) {
+         mantissa <<= 1;
+         --exponent;
+      }
+      f = sign | (exponent << 23) | ((mantissa & 0x03FF) << 13);
+   }
+   float value;
+   std::memcpy(&value, &f, sizeof(value));
+   return value;
+}
+
+/// Writes count elements given by encode(i) as unsigned integers of type UIntT into byte planes: the first count
+/// bytes of destination take the least significant bytes of all the elements, the next count bytes take the
+/// second bytes and so on. The on-disk byte order is thus little endian independent of the platform. The loops are
+/// kept trivial such that the compiler can vectorize them.
+template <typename UIntT, typename EncodeT>
+void SplitPack(unsigned char *destination, std::size_t count, EncodeT encode)
+{
+   for (std::size_t b = 0; b < sizeof(UIntT); ++b) {
+      unsigned char *plane = destination + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         plane[i] = static_cast<unsigned char>(encode(i) >> (8 * b));
+   }
+}
+
+/// Inverse of SplitPack(): reassembles count unsigned integers of type UIntT from their byte planes in source and
+/// hands them over one by one to decode(i, value)
+template <typename UIntT, typename DecodeT>
+void SplitUnpack(const unsigned char *source, std::size_t count, DecodeT decode)
+{
+   for (std::size_t i = 0; i < count; ++i) {
+      UIntT value = 0;
+      for (std::size_t b = 0; b < sizeof(UIntT); ++b)
+         value |= static_cast<UIntT>(source[b * count + i]) << (8 * b);
+      decode(i, value);
+   }
+}
+
+/// Maps signed integers of small magnitude to unsigned integers of small magnitude: 0, -1, 1, -2, ... -> 0, 1, 2, 3
+template <typename IntT>
+typename std::make_unsigned<IntT>::type EncodeZigzag(IntT value)
+{
+   using UIntT = typename std::make_unsigned<IntT>::type;
+   const UIntT bits = static_cast<UIntT>(value);
+   return (bits << 1) ^ (UIntT(0) - (bits >> (8 * sizeof(IntT) - 1)));
+}
+
+template <typename UIntT>
+typename std::make_signed<UIntT>::type DecodeZigzag(UIntT value)
+{
+   return static_cast<typename std::make_signed<UIntT>::type>((value >> 1) ^ (UIntT(0) - (value & 1)));
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -44,6 +158,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kReal16:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal16>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -71,6 +197,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kReal16:
+      return 16;
+   case EColumnType::kSplitIndex:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
    default:
       R__ASSERT(false);
    }
@@ -98,11 +236,63 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kReal16:
+      return "Real16";
+   case EColumnType::kSplitIndex:
+      return "SplitIndex";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
    default:
       return "UNKNOWN";
    }
 }
 
+ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RColumnElementBase::GetSplitType(EColumnType type)
+{
+   switch (type) {
+   case EColumnType::kIndex:
+      return EColumnType::kSplitIndex;
+   case EColumnType::kReal64:
+      return EColumnType::kSplitReal64;
+   case EColumnType::kReal32:
+      return EColumnType::kSplitReal32;
+   case EColumnType::kInt64:
+      return EColumnType::kSplitInt64;
+   case EColumnType::kInt32:
+      return EColumnType::kSplitInt32;
+   default:
+      return EColumnType::kUnknown;
+   }
+}
+
+bool ROOT::Experimental::Detail::RColumnElementBase::IsSameUnpackedType(EColumnType lhs, EColumnType rhs)
+{
+   auto fnUnpackedType = [](EColumnType type) {
+      switch (type) {
+      case EColumnType::kSplitIndex:
+         return EColumnType::kIndex;
+      case EColumnType::kSplitReal64:
+         return EColumnType::kReal64;
+      case EColumnType::kSplitReal32:
+      case EColumnType::kReal16:
+         return EColumnType::kReal32;
+      case EColumnType::kSplitInt64:
+         return EColumnType::kInt64;
+      case EColumnType::kSplitInt32:
+         return EColumnType::kInt32;
+      default:
+         return type;
+      }
+   };
+   return fnUnpackedType(lhs) == fnUnpackedType(rhs);
+}
+
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
   void *dst, void *src, std::size_t count) const
 {
@@ -157,3 +347,131 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
       int64Array[i] = int32Array[i];
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   float *floatArray = reinterpret_cast<float *>(src);
+   std::uint16_t *halfArray = reinterpret_cast<std::uint16_t *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      halfArray[i] = FloatToHalf(floatArray[i]);
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   std::uint16_t *halfArray = reinterpret_cast<std::uint16_t *>(src);
+   float *floatArray = reinterpret_cast<float *>(dst);
+   for (std::size_t i = 0; i < count; ++i) {
+      floatArray[i] = HalfToFloat(halfArray[i]);
+   }
+}
+
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   const unsigned char *bytes = reinterpret_cast<const unsigned char *>(src);
+   SplitPack<std::uint64_t>(reinterpret_cast<unsigned char *>(dst), count, [bytes](std::size_t i) {
+      std::uint64_t value;
+      std::memcpy(&value, bytes + i * sizeof(value), sizeof(value));
+      return value;
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   unsigned char *bytes = reinterpret_cast<unsigned char *>(dst);
+   SplitUnpack<std::uint64_t>(reinterpret_cast<const unsigned char *>(src), count,
+                              [bytes](std::size_t i, std::uint64_t value) {
+                                 std::memcpy(bytes + i * sizeof(value), &value, sizeof(value));
+                              });
+}
+
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   const unsigned char *bytes = reinterpret_cast<const unsigned char *>(src);
+   SplitPack<std::uint32_t>(reinterpret_cast<unsigned char *>(dst), count, [bytes](std::size_t i) {
+      std::uint32_t value;
+      std::memcpy(&value, bytes + i * sizeof(value), sizeof(value));
+      return value;
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   unsigned char *bytes = reinterpret_cast<unsigned char *>(dst);
+   SplitUnpack<std::uint32_t>(reinterpret_cast<const unsigned char *>(src), count,
+                              [bytes](std::size_t i, std::uint32_t value) {
+                                 std::memcpy(bytes + i * sizeof(value), &value, sizeof(value));
+                              });
+}
+
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   const std::int64_t *int64Array = reinterpret_cast<const std::int64_t *>(src);
+   SplitPack<std::uint64_t>(reinterpret_cast<unsigned char *>(dst), count,
+                            [int64Array](std::size_t i) { return EncodeZigzag(int64Array[i]); });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   std::int64_t *int64Array = reinterpret_cast<std::int64_t *>(dst);
+   SplitUnpack<std::uint64_t>(reinterpret_cast<const unsigned char *>(src), count,
+                              [int64Array](std::size_t i, std::uint64_t value) {
+                                 int64Array[i] = DecodeZigzag(value);
+                              });
+}
+
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   const std::int32_t *int32Array = reinterpret_cast<const std::int32_t *>(src);
+   SplitPack<std::uint32_t>(reinterpret_cast<unsigned char *>(dst), count,
+                            [int32Array](std::size_t i) { return EncodeZigzag(int32Array[i]); });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   std::int32_t *int32Array = reinterpret_cast<std::int32_t *>(dst);
+   SplitUnpack<std::uint32_t>(reinterpret_cast<const unsigned char *>(src), count,
+                              [int32Array](std::size_t i, std::uint32_t value) {
+                                 int32Array[i] = DecodeZigzag(value);
+                              });
+}
+
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   // Offsets are monotonically increasing within a page, so the deltas are small and mostly fill the low byte planes.
+   // The delta of the first element is taken with respect to zero.
+   const ClusterSize_t *indexArray = reinterpret_cast<const ClusterSize_t *>(src);
+   SplitPack<ClusterSize_t::ValueType>(reinterpret_cast<unsigned char *>(dst), count, [indexArray](std::size_t i) {
+      return indexArray[i].fValue - ((i == 0) ? 0 : indexArray[i - 1].fValue);
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ClusterSize_t *indexArray = reinterpret_cast<ClusterSize_t *>(dst);
+   ClusterSize_t::ValueType sum = 0;
+   SplitUnpack<ClusterSize_t::ValueType>(reinterpret_cast<const unsigned char *>(src), count,
+                                         [indexArray, &sum](std::size_t i, ClusterSize_t::ValueType value) {
+                                            sum += value;
+                                            indexArray[i].fValue = sum;
+                                         });
+}
@@ -309,7 +309,9 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 
    const auto &columnDesc = desc.GetColumnDescriptor(columnId);
    for (auto type : requestedTypes) {
-      if (type == columnDesc.GetModel().GetType())
+      // The split encoding of a column type is read transparently by the column
+      if ((type == columnDesc.GetModel().GetType()) ||
+          (RColumnElementBase::GetSplitType(type) == columnDesc.GetModel().GetType()))
          return type;
    }
    throw RException(R__FAIL(
@@ -532,6 +534,12 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
+   if (fIsHalfPrecision) {
+      RColumnModel model(EColumnType::kReal16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kReal16>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
@@ -539,7 +547,8 @@ void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kReal32, EColumnType::kReal16}, 0, desc);
+   fIsHalfPrecision = (type == EColumnType::kReal16);
    GenerateColumnsImpl();
 }
 
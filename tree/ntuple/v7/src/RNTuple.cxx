@@ -62,6 +62,84 @@ void ROOT::Experimental::RNTupleImtTaskScheduler::Wait()
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNTupleThreadPoolTaskScheduler::RNTupleThreadPoolTaskScheduler(unsigned int nThreads)
+{
+   R__ASSERT(nThreads > 0);
+   for (unsigned int i = 0; i < nThreads; ++i)
+      fWorkers.emplace_back(&RNTupleThreadPoolTaskScheduler::ExecTasks, this);
+}
+
+
+ROOT::Experimental::RNTupleThreadPoolTaskScheduler::~RNTupleThreadPoolTaskScheduler()
+{
+   {
+      std::unique_lock<std::mutex> lock(fLock);
+      fIsShutdown = true;
+      fCvHasWork.notify_all();
+   }
+   for (auto &w : fWorkers)
+      w.join();
+}
+
+
+void ROOT::Experimental::RNTupleThreadPoolTaskScheduler::RunTask(std::function<void(void)> &task,
+                                                                 std::unique_lock<std::mutex> &lock)
+{
+   lock.unlock();
+   task();
+   lock.lock();
+   if (--fNUnfinished == 0)
+      fCvIsDone.notify_all();
+}
+
+
+void ROOT::Experimental::RNTupleThreadPoolTaskScheduler::ExecTasks()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   while (true) {
+      fCvHasWork.wait(lock, [this]{ return fIsShutdown || !fTasks.empty(); });
+      if (fTasks.empty())
+         return;
+      auto task = std::move(fTasks.front());
+      fTasks.pop();
+      RunTask(task, lock);
+   }
+}
+
+
+void ROOT::Experimental::RNTupleThreadPoolTaskScheduler::Reset()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   // The previous set of tasks must have been waited for
+   R__ASSERT(fNUnfinished == 0);
+}
+
+
+void ROOT::Experimental::RNTupleThreadPoolTaskScheduler::AddTask(const std::function<void(void)> &taskFunc)
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   fTasks.emplace(taskFunc);
+   ++fNUnfinished;
+   fCvHasWork.notify_one();
+}
+
+
+void ROOT::Experimental::RNTupleThreadPoolTaskScheduler::Wait()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   // Rather than idling, the waiting thread processes queued tasks, too
+   while (!fTasks.empty()) {
+      auto task = std::move(fTasks.front());
+      fTasks.pop();
+      RunTask(task, lock);
+   }
+   fCvIsDone.wait(lock, [this]{ return fNUnfinished == 0; });
+}
+
+
+//------------------------------------------------------------------------------
+
+
 void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model) {
    const auto &desc = fSource->GetDescriptor();
    model.GetFieldZero()->SetOnDiskId(desc.GetFieldZeroId());
@@ -77,8 +155,13 @@ void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model)
 
 void ROOT::Experimental::RNTupleReader::InitPageSource()
 {
+   const auto nUnzipThreads = fSource->GetReadOptions().GetNUnzipThreads();
+   if (nUnzipThreads > 0) {
+      fUnzipTasks = std::make_unique<RNTupleThreadPoolTaskScheduler>(nUnzipThreads);
+      fSource->SetTaskScheduler(fUnzipTasks.get());
+   }
 #ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
+   if (!fUnzipTasks && IsImplicitMTEnabled()) {
       fUnzipTasks = std::make_unique<RNTupleImtTaskScheduler>();
       fSource->SetTaskScheduler(fUnzipTasks.get());
    }
@@ -221,6 +304,19 @@ ROOT::Experimental::RNTupleReader *ROOT::Experimental::RNTupleReader::GetDisplay
 }
 
 
+std::vector<ROOT::Experimental::RNTupleReadOptions::REntryRange>
+ROOT::Experimental::RNTupleReader::FindEntryRanges(std::string_view fieldName, double min, double max)
+{
+   const auto &descriptor = fSource->GetDescriptor();
+   auto fieldId = descriptor.FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId) {
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '"
+         + descriptor.GetName() + "'"));
+   }
+   return descriptor.FindEntryRanges(fieldId, min, max);
+}
+
+
 void ROOT::Experimental::RNTupleReader::Show(NTupleSize_t index, const ENTupleShowFormat format, std::ostream &output)
 {
    RNTupleReader *reader = this;
@@ -281,8 +377,17 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    if (!fSink) {
       throw RException(R__FAIL("null sink"));
    }
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
+      fSink->SetTaskScheduler(fZipTasks.get());
+   }
+#endif
    fSink->Create(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
+   // The counters of the sink wrapped by a buffered sink are found at the same path as without buffering
+   if (auto bufferedSink = dynamic_cast<Detail::RPageSinkBuf *>(fSink.get()))
+      fMetrics.ObserveMetrics(bufferedSink->GetInnerMetrics());
 }
 
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
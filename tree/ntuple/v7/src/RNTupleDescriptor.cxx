@@ -120,12 +120,15 @@ std::uint32_t SerializeFrame(std::uint16_t protocolVersionCurrent, std::uint16_t
    return 8;
 }
 
-std::uint32_t DeserializeFrame(std::uint16_t protocolVersion, const void *buffer, std::uint32_t *size)
+std::uint32_t DeserializeFrame(std::uint16_t protocolVersion, const void *buffer, std::uint32_t *size,
+   std::uint16_t *protocolVersionAtWrite = nullptr)
 {
    auto bytes = reinterpret_cast<const unsigned char *>(buffer);
-   std::uint16_t protocolVersionAtWrite;
+   std::uint16_t versionAtWrite;
    std::uint16_t protocolVersionMinRequired;
-   bytes += DeserializeUInt16(bytes, &protocolVersionAtWrite);
+   bytes += DeserializeUInt16(bytes, &versionAtWrite);
+   if (protocolVersionAtWrite)
+      *protocolVersionAtWrite = versionAtWrite;
    bytes += DeserializeUInt16(bytes, &protocolVersionMinRequired);
    if (protocolVersion < protocolVersionMinRequired) {
       throw ROOT::Experimental::RException(R__FAIL("RNTuple version too new (version "
@@ -267,6 +270,51 @@ std::uint32_t DeserializeColumnRange(const void *buffer,
    return 20;
 }
 
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   static_assert(sizeof(bits) == sizeof(val), "unexpected size of double");
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
+std::uint32_t SerializeValueRange(const ROOT::Experimental::RClusterDescriptor::RValueRange &val, void *buffer)
+{
+   // Without statistics, only the flag is stored
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeUInt32(val.fIsValid, pos);
+      if (val.fIsValid) {
+         pos += SerializeDouble(val.fMin, pos);
+         pos += SerializeDouble(val.fMax, pos);
+      }
+   }
+   return val.fIsValid ? 20 : 4;
+}
+
+std::uint32_t DeserializeValueRange(const void *buffer,
+   ROOT::Experimental::RClusterDescriptor::RValueRange *valueRange)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   std::uint32_t isValid;
+   bytes += DeserializeUInt32(bytes, &isValid);
+   *valueRange = ROOT::Experimental::RClusterDescriptor::RValueRange();
+   if (isValid == 0)
+      return 4;
+   valueRange->fIsValid = true;
+   bytes += DeserializeDouble(bytes, &valueRange->fMin);
+   bytes += DeserializeDouble(bytes, &valueRange->fMax);
+   return 20;
+}
+
 std::uint32_t SerializePageInfo(const ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo &val, void *buffer)
 {
    // To keep the cluster footers small, we don't put a frame around individual page infos.
@@ -546,9 +594,24 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
    auto pos = base;
    void** where = (buffer == nullptr) ? &buffer : reinterpret_cast<void**>(&pos);
 
+   // Without any value range, the footer is written in the layout of version 0 so that older readers can open it
+   bool hasValueRanges = false;
+   for (const auto &cluster : fClusterDescriptors) {
+      for (const auto &column : fColumnDescriptors) {
+         const auto &pageRange = cluster.second.GetPageRange(column.first);
+         hasValueRanges = hasValueRanges || cluster.second.GetColumnRange(column.first).fValueRange.fIsValid ||
+            std::any_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                        [](const RClusterDescriptor::RPageRange::RPageInfo &pi) { return pi.fValueRange.fIsValid; });
+      }
+   }
+
    void *ptrSize = nullptr;
-   pos += SerializeFrame(
-      RNTupleDescriptor::kFrameVersionCurrent, RNTupleDescriptor::kFrameVersionMin, *where, &ptrSize);
+   if (hasValueRanges) {
+      pos += SerializeFrame(
+         RNTupleDescriptor::kFrameVersionCurrent, RNTupleDescriptor::kFrameVersionMinFooterRanges, *where, &ptrSize);
+   } else {
+      pos += SerializeFrame(0, 0, *where, &ptrSize);
+   }
    pos += SerializeUInt64(0, *where); // reserved; can be at some point used, e.g., for compression flags
 
    pos += SerializeUInt64(fClusterDescriptors.size(), *where);
@@ -564,6 +627,8 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
          const auto &columnRange = cluster.second.GetColumnRange(columnId);
          R__ASSERT(columnRange.fColumnId == columnId);
          pos += SerializeColumnRange(columnRange, *where);
+         if (hasValueRanges)
+            pos += SerializeValueRange(columnRange.fValueRange, *where);
 
          const auto &pageRange = cluster.second.GetPageRange(columnId);
          R__ASSERT(pageRange.fColumnId == columnId);
@@ -571,6 +636,8 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
          pos += SerializeUInt32(nPages, *where);
          for (unsigned int i = 0; i < nPages; ++i) {
             pos += SerializePageInfo(pageRange.fPageInfos[i], *where);
+            if (hasValueRanges)
+               pos += SerializeValueRange(pageRange.fPageInfos[i].fValueRange, *where);
          }
       }
    }
@@ -708,6 +775,54 @@ ROOT::Experimental::RNTupleDescriptor::FindNextClusterId(DescriptorId_t clusterI
 }
 
 
+std::vector<ROOT::Experimental::REntryRange>
+ROOT::Experimental::RNTupleDescriptor::FindEntryRanges(DescriptorId_t fieldId, double min, double max) const
+{
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &cd : fClusterDescriptors)
+      clusters.emplace_back(&cd.second);
+   std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+      return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+   });
+
+   std::vector<REntryRange> result;
+   auto fnAddRange = [&result](NTupleSize_t firstEntry, NTupleSize_t nEntries) {
+      if (!result.empty() && (result.back().fFirstEntry + result.back().fNEntries == firstEntry)) {
+         result.back().fNEntries += nEntries;
+         return;
+      }
+      REntryRange range;
+      range.fFirstEntry = firstEntry;
+      range.fNEntries = nEntries;
+      result.emplace_back(range);
+   };
+
+   const auto columnId = FindColumnId(fieldId, 0);
+   // The elements of the principal column of top-level fields correspond one-to-one to the entries
+   const bool isTopLevel = (GetFieldDescriptor(fieldId).GetParentId() == GetFieldZeroId());
+   for (auto cd : clusters) {
+      if ((columnId == kInvalidDescriptorId) || !cd->ContainsColumn(columnId)) {
+         fnAddRange(cd->GetFirstEntryIndex(), cd->GetNEntries());
+         continue;
+      }
+      const auto &columnRange = cd->GetColumnRange(columnId);
+      if (!columnRange.fValueRange.Overlaps(min, max))
+         continue;
+      if (!isTopLevel) {
+         fnAddRange(cd->GetFirstEntryIndex(), cd->GetNEntries());
+         continue;
+      }
+      auto firstInPage = columnRange.fFirstElementIndex;
+      for (const auto &pageInfo : cd->GetPageRange(columnId).fPageInfos) {
+         if (pageInfo.fValueRange.Overlaps(min, max))
+            fnAddRange(firstInPage, pageInfo.fNElements);
+         firstInPage += pageInfo.fNElements;
+      }
+   }
+   return result;
+}
+
+
 // TODO(jblomer): fix for cases of sharded clasters
 ROOT::Experimental::DescriptorId_t
 ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterId) const
@@ -835,7 +950,8 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
    auto base = pos;
 
    std::uint32_t frameSize;
-   pos += DeserializeFrame(RNTupleDescriptor::kFrameVersionCurrent, pos, &frameSize);
+   std::uint16_t footerVersion;
+   pos += DeserializeFrame(RNTupleDescriptor::kFrameVersionCurrent, pos, &frameSize, &footerVersion);
    VerifyCrc32(base, frameSize);
    std::uint64_t reserved;
    pos += DeserializeUInt64(pos, &reserved);
@@ -873,6 +989,8 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          RClusterDescriptor::RColumnRange columnRange;
          columnRange.fColumnId = columnId;
          pos += DeserializeColumnRange(pos, &columnRange);
+         if (footerVersion >= 1)
+            pos += DeserializeValueRange(pos, &columnRange.fValueRange);
          AddClusterColumnRange(clusterId, columnRange);
 
          RClusterDescriptor::RPageRange pageRange;
@@ -882,6 +1000,8 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          for (unsigned int k = 0; k < nPages; ++k) {
             RClusterDescriptor::RPageRange::RPageInfo pageInfo;
             pos += DeserializePageInfo(pos, &pageInfo);
+            if (footerVersion >= 1)
+               pos += DeserializeValueRange(pos, &pageInfo.fValueRange);
             pageRange.fPageInfos.emplace_back(pageInfo);
          }
          AddClusterPageRange(clusterId, std::move(pageRange));
@@ -14,16 +14,72 @@
  *************************************************************************/
 
 #include <ROOT/RError.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <TError.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+#include <TList.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
       return -1;
    }
-   return -1;
+   // The first entry of the inputs is an object named after the ntuple, the remaining entries are the input files
+   if (inputs->GetEntries() < 2) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+
+   auto outFile = dynamic_cast<TFile *>(mergeInfo->fOutputDirectory);
+   if (!outFile) {
+      Error("RNTuple::Merge", "RNTuple '%s' can only be merged into the top-level directory of a file",
+            ntupleName.c_str());
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   while (auto obj = itr()) {
+      auto inFile = dynamic_cast<TFile *>(obj);
+      if (!inFile) {
+         Error("RNTuple::Merge", "expected a TFile as input, got a %s", obj->ClassName());
+         return -1;
+      }
+      sources.emplace_back(std::make_unique<Detail::RPageSourceFile>(ntupleName, inFile->GetName(),
+                                                                     RNTupleReadOptions()));
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+
+   RNTupleWriteOptions options;
+   options.SetCompression(outFile->GetCompressionSettings());
+   auto destination = std::make_unique<Detail::RPageSinkFile>(ntupleName, *outFile, options);
+
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sourcePtrs, *destination);
+   } catch (const RException &e) {
+      Error("RNTuple::Merge", "%s", e.what());
+      return -1;
+   }
+   return 0;
 }
 
 
@@ -37,3 +93,144 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+std::vector<ROOT::Experimental::RNTupleMerger::RColumnInfo>
+ROOT::Experimental::RNTupleMerger::CollectColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination)
+{
+   if (source.GetNColumns() != destination.GetNColumns())
+      throw RException(R__FAIL("ntuple '" + source.GetName() +
+                               "' has a different number of columns than the merged ntuple"));
+
+   std::vector<RColumnInfo> columns;
+   for (std::size_t i = 0; i < destination.GetNColumns(); ++i) {
+      const auto &dstColumn = destination.GetColumnDescriptor(i);
+      const auto fieldName = destination.GetQualifiedFieldName(dstColumn.GetFieldId());
+      const auto srcFieldId = source.FindFieldId(fieldName);
+      const auto srcColumnId = source.FindColumnId(srcFieldId, dstColumn.GetIndex());
+      if (srcColumnId == kInvalidDescriptorId)
+         throw RException(R__FAIL("missing column #" + std::to_string(dstColumn.GetIndex()) + " of field '" +
+                                  fieldName + "' in ntuple '" + source.GetName() + "'"));
+      const auto &srcColumn = source.GetColumnDescriptor(srcColumnId);
+      const auto srcType = srcColumn.GetModel().GetType();
+      const auto dstType = dstColumn.GetModel().GetType();
+      if (!Detail::RColumnElementBase::IsSameUnpackedType(srcType, dstType))
+         throw RException(R__FAIL("incompatible column #" + std::to_string(dstColumn.GetIndex()) + " of field '" +
+                                  fieldName + "' in ntuple '" + source.GetName() + "'"));
+
+      RColumnInfo info;
+      info.fSourceId = srcColumnId;
+      info.fDestinationId = dstColumn.GetId();
+      info.fBitsOnStorage = Detail::RColumnElementBase::GetBitsOnStorage(srcType);
+      if (srcType != dstType) {
+         info.fSourceElement = Detail::RColumnElementBase::Generate(srcType);
+         info.fDestinationElement = Detail::RColumnElementBase::Generate(dstType);
+      }
+      columns.emplace_back(std::move(info));
+   }
+   return columns;
+}
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(const std::vector<Detail::RPageSource *> &sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input ntuples to merge"));
+
+   std::unique_ptr<RNTupleModel> model;
+   const auto compressionSettings = destination.GetWriteOptions().GetCompression();
+   // Only used if the compression settings or the encoding of a source cluster differ from the destination
+   Detail::RNTupleDecompressor decompressor;
+   Detail::RNTupleCompressor compressor;
+   std::unique_ptr<unsigned char []> sealedBuffer;
+   std::size_t szSealedBuffer = 0;
+   std::unique_ptr<unsigned char []> packedBuffer;
+   std::size_t szPackedBuffer = 0;
+   std::unique_ptr<unsigned char []> unpackedBuffer;
+   std::size_t szUnpackedBuffer = 0;
+   std::unique_ptr<unsigned char []> repackedBuffer;
+   std::size_t szRepackedBuffer = 0;
+
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      source->Attach();
+      const auto &descriptor = source->GetDescriptor();
+      if (!model) {
+         model = descriptor.GenerateModel();
+         destination.Create(*model);
+      }
+      const auto columns = CollectColumns(descriptor, destination.GetDescriptor());
+
+      // Clusters are stored in unspecified order in the descriptor, we need to copy them in entry order
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &clusterDesc : descriptor.GetClusterIterable())
+         clusterIds.emplace_back(clusterDesc.GetId());
+      std::sort(clusterIds.begin(), clusterIds.end(), [&descriptor](DescriptorId_t a, DescriptorId_t b) {
+         return descriptor.GetClusterDescriptor(a).GetFirstEntryIndex() <
+                descriptor.GetClusterDescriptor(b).GetFirstEntryIndex();
+      });
+
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = descriptor.GetClusterDescriptor(clusterId);
+         for (const auto &column : columns) {
+            const bool needsRecompression =
+               clusterDesc.GetColumnRange(column.fSourceId).fCompressionSettings != compressionSettings;
+            const auto &pageRange = clusterDesc.GetPageRange(column.fSourceId);
+            std::uint32_t firstInPage = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+               if (bytesOnStorage > szSealedBuffer) {
+                  szSealedBuffer = bytesOnStorage;
+                  sealedBuffer = std::make_unique<unsigned char []>(szSealedBuffer);
+               }
+               Detail::RPageStorage::RSealedPage sealedPage;
+               sealedPage.fBuffer = sealedBuffer.get();
+               source->LoadSealedPage(column.fSourceId, RClusterIndex(clusterId, firstInPage), sealedPage);
+               R__ASSERT(sealedPage.fSize == bytesOnStorage);
+
+               if (needsRecompression || column.fSourceElement) {
+                  const auto nElements = sealedPage.fNElements;
+                  std::size_t bytesPacked = (column.fBitsOnStorage * nElements + 7) / 8;
+                  if (bytesPacked > szPackedBuffer) {
+                     szPackedBuffer = bytesPacked;
+                     packedBuffer = std::make_unique<unsigned char []>(szPackedBuffer);
+                  }
+                  decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, packedBuffer.get());
+                  unsigned char *packed = packedBuffer.get();
+
+                  if (column.fSourceElement) {
+                     R__ASSERT(column.fSourceElement->GetSize() == column.fDestinationElement->GetSize());
+                     const std::size_t bytesUnpacked = column.fSourceElement->GetSize() * nElements;
+                     if (bytesUnpacked > szUnpackedBuffer) {
+                        szUnpackedBuffer = bytesUnpacked;
+                        unpackedBuffer = std::make_unique<unsigned char []>(szUnpackedBuffer);
+                     }
+                     column.fSourceElement->Unpack(unpackedBuffer.get(), packed, nElements);
+                     bytesPacked = column.fDestinationElement->GetPackedSize(nElements);
+                     if (bytesPacked > szRepackedBuffer) {
+                        szRepackedBuffer = bytesPacked;
+                        repackedBuffer = std::make_unique<unsigned char []>(szRepackedBuffer);
+                     }
+                     column.fDestinationElement->Pack(repackedBuffer.get(), unpackedBuffer.get(), nElements);
+                     packed = repackedBuffer.get();
+                  }
+
+                  sealedPage.fSize = compressor.Zip(packed, bytesPacked, compressionSettings);
+                  sealedPage.fBuffer = compressor.GetZipBuffer();
+               }
+
+               destination.CommitSealedPage(column.fDestinationId, sealedPage);
+               firstInPage += pageInfo.fNElements;
+            }
+         }
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+
+   destination.CommitDataset();
+}
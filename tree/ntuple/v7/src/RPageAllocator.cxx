@@ -18,6 +18,8 @@
 
 #include <TError.h>
 
+#include <utility>
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
 {
@@ -31,3 +33,88 @@ void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& pag
 {
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RPageAllocatorArena::RPageAllocatorArena(std::size_t maxRetained)
+   : fMetrics("RPageAllocatorArena"), fMaxRetained(maxRetained)
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szAllocated", "B", "volume of newly allocated buffers"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReused", "B", "volume of recycled buffers"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nAllocated", "", "number of newly allocated buffers"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReused", "", "number of recycled buffers")
+   });
+}
+
+ROOT::Experimental::Detail::RPageAllocatorArena::~RPageAllocatorArena()
+{
+   for (auto &freeList : fFreeLists) {
+      for (auto buffer : freeList.second)
+         delete[] buffer;
+   }
+}
+
+std::size_t ROOT::Experimental::Detail::RPageAllocatorArena::GetBlockSize(std::size_t nbytes)
+{
+   if (nbytes <= kMinBlockSize)
+      return kMinBlockSize;
+   // For nbytes in (2^k, 2^(k+1)], the size classes are the multiples of 2^(k-2)
+   std::size_t powerOfTwo = kMinBlockSize;
+   while (2 * powerOfTwo < nbytes)
+      powerOfTwo *= 2;
+   const auto step = powerOfTwo / 4;
+   return ((nbytes + step - 1) / step) * step;
+}
+
+unsigned char *ROOT::Experimental::Detail::RPageAllocatorArena::Allocate(std::size_t nbytes)
+{
+   const auto blockSize = GetBlockSize(nbytes);
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      auto itr = fFreeLists.find(blockSize);
+      if ((itr != fFreeLists.end()) && !itr->second.empty()) {
+         auto buffer = itr->second.back();
+         itr->second.pop_back();
+         fSzRetained -= blockSize;
+         fCounters->fSzReused.Add(blockSize);
+         fCounters->fNReused.Inc();
+         return buffer;
+      }
+   }
+   fCounters->fSzAllocated.Add(blockSize);
+   fCounters->fNAllocated.Inc();
+   return new unsigned char[blockSize];
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorArena::Release(void *buffer, std::size_t nbytes)
+{
+   if (!buffer)
+      return;
+   const auto blockSize = GetBlockSize(nbytes);
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      if (fSzRetained + blockSize <= fMaxRetained) {
+         fFreeLists[blockSize].emplace_back(static_cast<unsigned char *>(buffer));
+         fSzRetained += blockSize;
+         return;
+      }
+   }
+   delete[] static_cast<unsigned char *>(buffer);
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorArena::NewPage(
+   ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   auto nbytes = elementSize * nElements;
+   return RPage(columnId, Allocate(nbytes), nbytes, elementSize);
+}
+
+std::size_t ROOT::Experimental::Detail::RPageAllocatorArena::GetSzRetained()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fSzRetained;
+}
@@ -18,14 +18,37 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
+#include <cstring>
+#include <string>
+
 ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
-   : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions()), fInnerSink(std::move(inner)) {}
+   : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions())
+   , fMetrics("RPageSinkBuf")
+   , fInnerSink(std::move(inner))
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("parallelZip", "", "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuZip", "ns",
+                                                                       "CPU time spent compressing"),
+      {}
+   });
+}
 
 void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &model)
 {
-   fBufferedColumns.resize(fLastColumnId);
+   // Constructed in place: the buffered columns cannot be relocated as they are neither copyable nor nothrow movable
+   fBufferedColumns = std::vector<RColumnBuf>(fLastColumnId);
+   for (DescriptorId_t i = 0; i < fLastColumnId; ++i) {
+      const auto &columnDesc = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(i);
+      fCounters->fTimeWallZipColumns.emplace_back(fMetrics.MakeCounter<RNTupleAtomicCounter*>(
+         "timeWallZipColumn" + std::to_string(i), "ns",
+         "wall clock time spent compressing column #" + std::to_string(columnDesc.GetIndex()) + " of field " +
+            fDescriptorBuilder.GetDescriptor().GetQualifiedFieldName(columnDesc.GetFieldId())));
+   }
    fInnerModel = model.Clone();
    fInnerSink->Create(*fInnerModel);
+   if (fTaskScheduler)
+      fTaskScheduler->Reset();
 }
 
 ROOT::Experimental::RClusterDescriptor::RLocator
@@ -36,7 +59,20 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    // make sure the page is aware of how many elements it will have
    R__ASSERT(bufPage.TryGrow(page.GetNElements()));
    memcpy(bufPage.GetBuffer(), page.GetBuffer(), page.GetSize());
-   fBufferedColumns.at(columnHandle.fId).BufferPage(columnHandle, bufPage);
+   auto &zipItem = fBufferedColumns.at(columnHandle.fId).BufferPage(columnHandle, bufPage);
+
+   if (fTaskScheduler) {
+      fCounters->fParallelZip.SetValue(1);
+      const auto element = columnHandle.fColumn->GetElement();
+      fBufferedColumns.at(columnHandle.fId).AllocateSealedPageBuf(zipItem, *element);
+      auto &timeWallZip = *fCounters->fTimeWallZipColumns.at(columnHandle.fId);
+      const auto compression = GetWriteOptions().GetCompression();
+      fTaskScheduler->AddTask([this, &zipItem, &timeWallZip, element, compression] {
+         RNTupleAtomicTimer timer(timeWallZip, fCounters->fTimeCpuZip);
+         zipItem.fSealedPage = SealPage(zipItem.fPage, *element, compression, zipItem.fBuf.fBuffer.get());
+      });
+   }
+
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
    return RClusterDescriptor::RLocator{};
@@ -55,12 +91,33 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
 {
-   for (auto &bufColumn : fBufferedColumns) {
-      for (auto &bufPage : bufColumn.DrainBufferedPages()) {
-         fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage);
-         ReleasePage(bufPage);
+   if (fTaskScheduler)
+      fTaskScheduler->Wait();
+
+   // Commit the sealed pages in the order of columns and pages, independent of the task completion order
+   for (DescriptorId_t i = 0; i < fBufferedColumns.size(); ++i) {
+      auto &bufColumn = fBufferedColumns[i];
+      // The value ranges of the buffered pages have been recorded by CommitPage() in the same order
+      const auto &pageInfos = fOpenPageRanges.at(i).fPageInfos;
+      std::size_t idxPage = 0;
+      for (auto &zipItem : bufColumn.DrainBufferedPages()) {
+         if (!fTaskScheduler) {
+            const auto element = bufColumn.GetHandle().fColumn->GetElement();
+            bufColumn.AllocateSealedPageBuf(zipItem, *element);
+            RNTupleAtomicTimer timer(*fCounters->fTimeWallZipColumns[i], fCounters->fTimeCpuZip);
+            zipItem.fSealedPage =
+               SealPage(zipItem.fPage, *element, GetWriteOptions().GetCompression(), zipItem.fBuf.fBuffer.get());
+         }
+         zipItem.fSealedPage.fValueRange = pageInfos.at(idxPage++).fValueRange;
+         fInnerSink->CommitSealedPage(i, zipItem.fSealedPage);
+         // The inner sink is done with the sealed page, so its scratch buffer can be used for the next page
+         bufColumn.RecycleSealedPageBuf(zipItem);
+         ReleasePage(zipItem.fPage);
       }
    }
+
+   if (fTaskScheduler)
+      fTaskScheduler->Reset();
    fInnerSink->CommitCluster(nEntries);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
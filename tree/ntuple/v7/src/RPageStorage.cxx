@@ -15,6 +15,7 @@
 
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -31,8 +32,119 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+using RValueRange = ROOT::Experimental::RClusterDescriptor::RValueRange;
+using ValueRangeFunc_t = RValueRange (*)(const ROOT::Experimental::Detail::RPage &, std::uint64_t &);
+
+/// Computes the value range of a page of arithmetic elements of type T. NaN values are ignored. An empty page results
+/// in a range with fMin > fMax, which does not overlap with any selection.
+template <typename T>
+RValueRange GetValueRange(const ROOT::Experimental::Detail::RPage &page, std::uint64_t & /* lastOffset */)
+{
+   auto values = reinterpret_cast<const T *>(page.GetBuffer());
+   using Limits_t = std::numeric_limits<T>;
+   T min = Limits_t::has_infinity ? Limits_t::infinity() : Limits_t::max();
+   T max = Limits_t::has_infinity ? -Limits_t::infinity() : Limits_t::lowest();
+   for (std::size_t i = 0; i < page.GetNElements(); ++i) {
+      if (values[i] < min)
+         min = values[i];
+      if (values[i] > max)
+         max = values[i];
+   }
+
+   RValueRange range;
+   range.fIsValid = true;
+   range.fMin = static_cast<double>(min);
+   range.fMax = static_cast<double>(max);
+   if (std::is_integral<T>::value && (sizeof(T) > 4)) {
+      // Not all 64bit integers are representable as doubles; make sure the range encloses the integer range
+      range.fMin = std::nextafter(range.fMin, -std::numeric_limits<double>::infinity());
+      range.fMax = std::nextafter(range.fMax, std::numeric_limits<double>::infinity());
+   }
+   return range;
+}
+
+/// Computes the range of the collection sizes of a page of an index column.  The offsets count relative to the
+/// start of the cluster, so the size of the first collection in the page depends on the last offset of the
+/// previous page.
+RValueRange GetSizeRange(const ROOT::Experimental::Detail::RPage &page, std::uint64_t &lastOffset)
+{
+   auto offsets = reinterpret_cast<const ROOT::Experimental::ClusterSize_t *>(page.GetBuffer());
+   std::uint64_t min = std::numeric_limits<std::uint64_t>::max();
+   std::uint64_t max = 0;
+   for (std::size_t i = 0; i < page.GetNElements(); ++i) {
+      std::uint64_t offset = offsets[i];
+      const auto size = offset - lastOffset;
+      min = std::min(min, size);
+      max = std::max(max, size);
+      lastOffset = offset;
+   }
+
+   RValueRange range;
+   range.fIsValid = true;
+   range.fMin = static_cast<double>(min);
+   range.fMax = static_cast<double>(max);
+   return range;
+}
+
+/// Returns the function that computes the value range of the pages of a column, given the column type and the type
+/// of the field that owns the column, or nullptr if no statistics are recorded for the column.  The field type
+/// resolves the signedness of integer columns.
+ValueRangeFunc_t GetValueRangeFunc(ROOT::Experimental::EColumnType columnType, const std::string &fieldType)
+{
+   using ROOT::Experimental::EColumnType;
+   switch (columnType) {
+   case EColumnType::kIndex:
+   case EColumnType::kSplitIndex:
+      // Fields of type ClusterSize_t store plain values in an index column; those are not collection offsets
+      if (fieldType == "ROOT::Experimental::ClusterSize_t")
+         return nullptr;
+      return GetSizeRange;
+   case EColumnType::kBit: return GetValueRange<bool>;
+   case EColumnType::kByte:
+      if (fieldType == "std::int8_t")
+         return GetValueRange<std::int8_t>;
+      if (fieldType == "std::uint8_t")
+         return GetValueRange<std::uint8_t>;
+      if (fieldType == "char")
+         return GetValueRange<char>;
+      return nullptr;
+   case EColumnType::kReal64:
+   case EColumnType::kSplitReal64: return GetValueRange<double>;
+   case EColumnType::kReal32:
+   case EColumnType::kSplitReal32:
+   case EColumnType::kReal16: return GetValueRange<float>;
+   case EColumnType::kInt64:
+   case EColumnType::kSplitInt64:
+      if (fieldType == "std::uint64_t")
+         return GetValueRange<std::uint64_t>;
+      return GetValueRange<std::int64_t>;
+   case EColumnType::kInt32:
+   case EColumnType::kSplitInt32:
+      if (fieldType == "std::uint32_t")
+         return GetValueRange<std::uint32_t>;
+      // std::int64_t fields may be stored in 32bit columns
+      if (fieldType == "std::int64_t")
+         return GetValueRange<std::int64_t>;
+      return GetValueRange<std::int32_t>;
+   case EColumnType::kInt16:
+      if (fieldType == "std::uint16_t")
+         return GetValueRange<std::uint16_t>;
+      return GetValueRange<std::int16_t>;
+   default: return nullptr;
+   }
+}
+
+} // anonymous namespace
+
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
 {
@@ -111,32 +223,50 @@ void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
       UnzipClusterImpl(cluster);
 }
 
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSource::LoadClusters(const std::vector<RClusterKey> &clusterKeys)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   clusters.reserve(clusterKeys.size());
+   for (const auto &key : clusterKeys)
+      clusters.emplace_back(LoadCluster(key.fClusterId, key.fColumns));
+   return clusters;
+}
+
 
 std::unique_ptr<unsigned char []> ROOT::Experimental::Detail::RPageSource::UnsealPage(
    const RSealedPage &sealedPage, const RColumnElementBase &element)
+{
+   auto pageBuffer = std::make_unique<unsigned char[]>(element.GetSize() * sealedPage.fNElements);
+   UnsealPage(sealedPage, element, pageBuffer.get());
+   return pageBuffer;
+}
+
+
+void ROOT::Experimental::Detail::RPageSource::UnsealPage(
+   const RSealedPage &sealedPage, const RColumnElementBase &element, unsigned char *pageBuffer)
 {
    const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
-   const auto pageSize = element.GetSize() * sealedPage.fNElements;
 
-   // TODO(jblomer): We might be able to do better memory handling for unsealing pages than a new malloc for every
-   // new page.
-   auto pageBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+   // Mappable elements are unzipped directly into the page buffer, others need an intermediate buffer for unpacking
+   std::unique_ptr<unsigned char []> packedBuffer;
+   unsigned char *target = pageBuffer;
+   if (!element.IsMappable()) {
+      packedBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+      target = packedBuffer.get();
+   }
+
    if (sealedPage.fSize != bytesPacked) {
-      fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, pageBuffer.get());
+      fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, target);
    } else {
       // We cannot simply map the sealed page as we don't know its life time. Specialized page sources
       // may decide to implement to not use UnsealPage but to custom mapping / decompression code.
       // Note that usually pages are compressed.
-      memcpy(pageBuffer.get(), sealedPage.fBuffer, bytesPacked);
-   }
-
-   if (!element.IsMappable()) {
-      auto unpackedBuffer = new unsigned char[pageSize];
-      element.Unpack(unpackedBuffer, pageBuffer.get(), sealedPage.fNElements);
-      pageBuffer = std::unique_ptr<unsigned char []>(unpackedBuffer);
+      memcpy(target, sealedPage.fBuffer, bytesPacked);
    }
 
-   return pageBuffer;
+   if (!element.IsMappable())
+      element.Unpack(pageBuffer, target, sealedPage.fNElements);
 }
 
 
@@ -208,6 +338,13 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 
    auto nColumns = fLastColumnId;
    for (DescriptorId_t i = 0; i < nColumns; ++i) {
+      const auto &columnDesc = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(i);
+      const auto &fieldDesc = fDescriptorBuilder.GetDescriptor().GetFieldDescriptor(columnDesc.GetFieldId());
+      fValueRangeFuncs.emplace_back(fOptions.GetUsePageStatistics()
+                                       ? GetValueRangeFunc(columnDesc.GetModel().GetType(), fieldDesc.GetTypeName())
+                                       : nullptr);
+      fOpenLastOffsets.emplace_back(0);
+
       RClusterDescriptor::RColumnRange columnRange;
       columnRange.fColumnId = i;
       columnRange.fFirstElementIndex = 0;
@@ -223,14 +360,29 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 }
 
 
-void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
+void ROOT::Experimental::Detail::RPageSink::AddPageInfo(DescriptorId_t columnId,
+                                                       const RClusterDescriptor::RPageRange::RPageInfo &pageInfo)
 {
-   fOpenColumnRanges.at(columnHandle.fId).fNElements += page.GetNElements();
+   auto &columnRange = fOpenColumnRanges.at(columnId);
+   auto &pageRange = fOpenPageRanges.at(columnId);
+   columnRange.fNElements += pageInfo.fNElements;
+   if (pageRange.fPageInfos.empty()) {
+      columnRange.fValueRange = pageInfo.fValueRange;
+   } else {
+      columnRange.fValueRange.Merge(pageInfo.fValueRange);
+   }
+   pageRange.fPageInfos.emplace_back(pageInfo);
+}
+
 
+void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
+{
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   if (auto valueRangeFunc = fValueRangeFuncs.at(columnHandle.fId))
+      pageInfo.fValueRange = valueRangeFunc(page, fOpenLastOffsets[columnHandle.fId]);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
-   fOpenPageRanges.at(columnHandle.fId).fPageInfos.emplace_back(pageInfo);
+   AddPageInfo(columnHandle.fId, pageInfo);
 }
 
 
@@ -238,12 +390,12 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    ROOT::Experimental::DescriptorId_t columnId,
    const ROOT::Experimental::Detail::RPageStorage::RSealedPage &sealedPage)
 {
-   fOpenColumnRanges.at(columnId).fNElements += sealedPage.fNElements;
-
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   if (fOptions.GetUsePageStatistics())
+      pageInfo.fValueRange = sealedPage.fValueRange;
    pageInfo.fLocator = CommitSealedPageImpl(columnId, sealedPage);
-   fOpenPageRanges.at(columnId).fPageInfos.emplace_back(pageInfo);
+   AddPageInfo(columnId, pageInfo);
 }
 
 
@@ -259,7 +411,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
+      range.fValueRange = RClusterDescriptor::RValueRange();
    }
+   std::fill(fOpenLastOffsets.begin(), fOpenLastOffsets.end(), 0);
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
       std::swap(fullRange, range);
@@ -273,29 +427,37 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
 
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
 ROOT::Experimental::Detail::RPageSink::SealPage(
-   const RPage &page, const RColumnElementBase &element, int compressionSetting)
+   const RPage &page, const RColumnElementBase &element, int compressionSetting, void *buf)
 {
-   unsigned char *buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   unsigned char *pageBuf = reinterpret_cast<unsigned char *>(page.GetBuffer());
    bool isAdoptedBuffer = true;
    auto packedBytes = page.GetSize();
 
    if (!element.IsMappable()) {
       packedBytes = element.GetPackedSize(page.GetNElements());
-      buffer = new unsigned char[packedBytes];
+      pageBuf = new unsigned char[packedBytes];
       isAdoptedBuffer = false;
-      element.Pack(buffer, page.GetBuffer(), page.GetNElements());
+      element.Pack(pageBuf, page.GetBuffer(), page.GetNElements());
    }
    auto zippedBytes = packedBytes;
 
    if ((compressionSetting != 0) || !element.IsMappable()) {
-      zippedBytes = fCompressor->Zip(buffer, packedBytes, fOptions.GetCompression());
+      zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buf);
       if (!isAdoptedBuffer)
-         delete[] buffer;
-      buffer = const_cast<unsigned char *>(reinterpret_cast<const unsigned char *>(fCompressor->GetZipBuffer()));
+         delete[] pageBuf;
+      pageBuf = reinterpret_cast<unsigned char *>(buf);
       isAdoptedBuffer = true;
    }
 
    R__ASSERT(isAdoptedBuffer);
 
-   return RSealedPage{buffer, zippedBytes, page.GetNElements()};
+   return RSealedPage{pageBuf, zippedBytes, page.GetNElements()};
+}
+
+ROOT::Experimental::Detail::RPageStorage::RSealedPage
+ROOT::Experimental::Detail::RPageSink::SealPage(
+   const RPage &page, const RColumnElementBase &element, int compressionSetting)
+{
+   R__ASSERT(fCompressor);
+   return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer());
 }
@@ -30,8 +30,10 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
 #include <utility>
 
@@ -54,6 +56,10 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageCommitted", "", "number of pages committed to storage")
    });
    fCompressor = std::make_unique<RNTupleCompressor>();
+   if (options.GetUsePageArena()) {
+      fPageArena = std::make_shared<RPageAllocatorArena>();
+      fMetrics.ObserveMetrics(fPageArena->GetMetrics());
+   }
 }
 
 
@@ -136,6 +142,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(
    RClusterDescriptor::RLocator result;
    result.fPosition = offsetData;
    result.fBytesOnStorage = sealedPage.fSize;
+   fCounters->fNPageCommitted.Inc();
    return result;
 }
 
@@ -173,11 +180,17 @@ ROOT::Experimental::Detail::RPageSinkFile::ReservePage(ColumnHandle_t columnHand
    if (nElements == 0)
       nElements = fOptions.GetNElementsPerPage();
    auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   if (fPageArena)
+      return fPageArena->NewPage(columnHandle.fId, elementSize, nElements);
    return fPageAllocator->NewPage(columnHandle.fId, elementSize, nElements);
 }
 
 void ROOT::Experimental::Detail::RPageSinkFile::ReleasePage(RPage &page)
 {
+   if (fPageArena) {
+      fPageArena->DeletePage(page);
+      return;
+   }
    fPageAllocator->DeletePage(page);
 }
 
@@ -223,6 +236,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "",
+                                                   "number of populated pages pointing into the file mapping"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
@@ -299,6 +314,10 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
          }
       )
    });
+   if (options.GetUsePageArena()) {
+      fPageArena = std::make_shared<RPageAllocatorArena>();
+      fMetrics.ObserveMetrics(fPageArena->GetMetrics());
+   }
 }
 
 
@@ -332,6 +351,27 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
    fDecompressor->Unzip(zipBuffer.get(), ntpl.fNBytesFooter, ntpl.fLenFooter, buffer.get());
    descBuilder.AddClustersFromFooter(buffer.get());
 
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      const auto fileSize = fFile->GetSize();
+      std::uint64_t mapdOffset = 0;
+      try {
+         auto region = fFile->Map(fileSize, 0, mapdOffset);
+         R__ASSERT(mapdOffset == 0);
+         // Clusters and pages pointing into the mapping can outlive the page source and thus share the raw file
+         auto file = fFile;
+         fFileMapping = std::shared_ptr<const unsigned char>(static_cast<const unsigned char *>(region),
+            [file, fileSize](const unsigned char *ptr) {
+               try {
+                  file->Unmap(const_cast<unsigned char *>(ptr), fileSize);
+               } catch (const std::exception &e) {
+                  R__LOG_ERROR(NTupleLog()) << "cannot unmap ntuple file: " << e.what();
+               }
+            });
+      } catch (const std::exception &e) {
+         R__LOG_WARNING(NTupleLog()) << "cannot memory map ntuple file, falling back to regular reads: " << e.what();
+      }
+   }
+
    return descBuilder.MoveDescriptor();
 }
 
@@ -363,6 +403,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (sealedPage.fBuffer)
       fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, pageInfo.fLocator.fPosition);
 }
@@ -390,13 +431,16 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    R__ASSERT((firstInPage + pageInfo.fNElements) > idxInCluster);
 
    const auto element = columnHandle.fColumn->GetElement();
-   const auto elementSize = element->GetSize();
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
 
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff && fFileMapping) {
+      sealedPageBuffer = fFileMapping.get() + pageInfo.fLocator.fPosition;
+      fCounters->fNPageLoaded.Inc();
+      fCounters->fSzReadPayload.Add(bytesOnStorage);
+   } else if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
       fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
       fCounters->fNPageLoaded.Inc();
@@ -418,21 +462,16 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
-   std::unique_ptr<unsigned char []> pageBuffer;
+   RPage newPage;
+   RPageDeleter pageDeleter;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
-      fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      newPage = MakePage(columnId, {sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, pageDeleter);
    }
 
    const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
+   fPagePool->RegisterPage(newPage, pageDeleter);
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -475,19 +514,84 @@ void ROOT::Experimental::Detail::RPageSourceFile::ReleasePage(RPage &page)
    fPagePool->ReturnPage(page);
 }
 
+unsigned char *ROOT::Experimental::Detail::RPageSourceFile::UnsealPageToNewBuffer(
+   const RSealedPage &sealedPage, const RColumnElementBase &element)
+{
+   if (!fPageArena)
+      return UnsealPage(sealedPage, element).release();
+   auto pageBuffer = fPageArena->Allocate(element.GetSize() * sealedPage.fNElements);
+   UnsealPage(sealedPage, element, pageBuffer);
+   return pageBuffer;
+}
+
+ROOT::Experimental::Detail::RPageDeleter ROOT::Experimental::Detail::RPageSourceFile::MakePageDeleter() const
+{
+   if (!fPageArena) {
+      return RPageDeleter([](const RPage &page, void * /*userData*/)
+      {
+         RPageAllocatorFile::DeletePage(page);
+      }, nullptr);
+   }
+   // The page pool might release pages after the page source is gone, thus the deleter shares the arena
+   auto pageArena = fPageArena;
+   return RPageDeleter([pageArena](const RPage &page, void * /*userData*/)
+   {
+      if (!page.IsNull())
+         pageArena->DeletePage(page);
+   }, nullptr);
+}
+
+bool ROOT::Experimental::Detail::RPageSourceFile::IsMappedPage(
+   const RSealedPage &sealedPage, const RColumnElementBase &element)
+{
+   if (!element.IsMappable())
+      return false;
+   const auto elementSize = element.GetSize();
+   if (sealedPage.fSize != elementSize * sealedPage.fNElements)
+      return false;
+   return (reinterpret_cast<std::uintptr_t>(sealedPage.fBuffer) % elementSize) == 0;
+}
+
+ROOT::Experimental::Detail::RPageDeleter ROOT::Experimental::Detail::RPageSourceFile::MakeMappedPageDeleter() const
+{
+   auto fileMapping = fFileMapping;
+   return RPageDeleter([fileMapping](const RPage & /*page*/, void * /*userData*/)
+   {
+      // The page memory is part of the mapping, which is released together with the last reference to it
+      (void)fileMapping;
+   }, nullptr);
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::MakePage(
+   DescriptorId_t columnId, const RSealedPage &sealedPage, const RColumnElementBase &element, RPageDeleter &deleter)
+{
+   const auto elementSize = element.GetSize();
+   if (fFileMapping && IsMappedPage(sealedPage, element)) {
+      fCounters->fNPageMapped.Inc();
+      deleter = MakeMappedPageDeleter();
+      return fPageAllocator->NewPage(columnId, const_cast<void *>(sealedPage.fBuffer), elementSize,
+                                     sealedPage.fNElements);
+   }
+
+   auto pageBuffer = UnsealPageToNewBuffer(sealedPage, element);
+   fCounters->fSzUnzip.Add(elementSize * sealedPage.fNElements);
+   deleter = MakePageDeleter();
+   return fPageAllocator->NewPage(columnId, pageBuffer, elementSize, sealedPage.fNElements);
+}
+
 std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceFile::Clone() const
 {
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
-   clone->fFile = fFile->Clone();
+   clone->fFile = std::shared_ptr<ROOT::Internal::RRawFile>(fFile->Clone());
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
+   const RClusterKey &clusterKey, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
-   fCounters->fNClusterLoaded.Inc();
-
+   const auto clusterId = clusterKey.fClusterId;
    const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
    auto clusterLocator = clusterDesc.GetLocator();
    auto clusterSize = clusterLocator.fBytesOnStorage;
@@ -507,7 +611,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    // Collect the page necessary page meta-data and sum up the total size of the compressed and packed pages
    std::vector<ROnDiskPageLocator> onDiskPages;
    auto activeSize = 0;
-   for (auto columnId : columns) {
+   for (auto columnId : clusterKey.fColumns) {
       const auto &pageRange = clusterDesc.GetPageRange(columnId);
       NTupleSize_t pageNo = 0;
       for (const auto &pageInfo : pageRange.fPageInfos) {
@@ -553,8 +657,8 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       std::uint64_t fOffset = 0;
       std::uint64_t fSize = 0;
    };
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
-
+   // The requests of this cluster are appended to the ones of the clusters prepared before
+   const auto iFirstRequest = readRequests.size();
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
    std::size_t szOverhead = 0;
@@ -586,16 +690,97 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fSzReadOverhead.Add(szOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   const std::size_t szBuffer = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize;
+   unsigned char *buffer = nullptr;
+   std::unique_ptr<ROnDiskPageMap> pageMap;
+   if (fPageArena) {
+      // The cluster memory is given back to the arena in one go when the cluster is released
+      buffer = fPageArena->Allocate(szBuffer);
+      pageMap = std::make_unique<ROnDiskPageMapArena>(fPageArena, buffer, szBuffer);
+   } else {
+      buffer = new unsigned char[szBuffer];
+      pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   }
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto &r : readRequests) {
-      r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
+   for (auto i = iFirstRequest; i < readRequests.size(); ++i) {
+      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : clusterKey.fColumns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::PrepareMappedCluster(const RClusterKey &clusterKey)
+{
+   const auto clusterId = clusterKey.fClusterId;
+   const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
+
+   auto pageMap = std::make_unique<ROnDiskPageMapMmap>(fFileMapping);
+   std::size_t nPages = 0;
+   std::size_t szPayload = 0;
+   for (auto columnId : clusterKey.fColumns) {
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         const auto &pageLocator = pageInfo.fLocator;
+         ROnDiskPage::Key key(columnId, pageNo);
+         // On-disk pages are read-only, the mapping is never written to
+         auto address = const_cast<unsigned char *>(fFileMapping.get()) + pageLocator.fPosition;
+         pageMap->Register(key, ROnDiskPage(address, pageLocator.fBytesOnStorage));
+         szPayload += pageLocator.fBytesOnStorage;
+         ++pageNo;
+      }
+      nPages += pageNo;
+   }
+   fCounters->fNPageLoaded.Add(nPages);
+   fCounters->fSzReadPayload.Add(szPayload);
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : clusterKey.fColumns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   RClusterKey clusterKey;
+   clusterKey.fClusterId = clusterId;
+   clusterKey.fColumns = columns;
+   auto clusters = LoadClusters({clusterKey});
+   return std::move(clusters[0]);
+}
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(const std::vector<RClusterKey> &clusterKeys)
+{
+   fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+   // The page byte ranges of all the requested clusters are issued in a single vector read.  If the raw file
+   // supports asynchronous I/O (e.g. io_uring), the requests are in flight concurrently.
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   if (fFileMapping) {
+      // No I/O necessary, the pages are paged in by the kernel on first access
+      for (const auto &key : clusterKeys)
+         clusters.emplace_back(PrepareMappedCluster(key));
+      return clusters;
+   }
+
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   for (const auto &key : clusterKeys) {
+      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
+   if (readRequests.empty())
+      return clusters;
 
    auto nReqs = readRequests.size();
    {
@@ -605,11 +790,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
-   auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
-   for (auto colId : columns)
-      cluster->SetColumnAvailable(colId);
-   return cluster;
+   return clusters;
 }
 
 
@@ -643,16 +824,11 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
-               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
-               fCounters->fSzUnzip.Add(element->GetSize() * nElements);
-
-               auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
+               RPageDeleter pageDeleter;
+               auto newPage = MakePage(columnId, {onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements},
+                                       *element, pageDeleter);
                newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-               fPagePool->PreloadPage(newPage,
-                  RPageDeleter([](const RPage &page, void * /*userData*/)
-                  {
-                     RPageAllocatorFile::DeletePage(page);
-                  }, nullptr));
+               fPagePool->PreloadPage(newPage, pageDeleter);
             };
 
          fTaskScheduler->AddTask(taskFunc);
@@ -14,7 +14,9 @@
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <cstring>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -56,13 +58,28 @@ public:
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RPageSource::ColumnSet_t> fReqsColumns;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   /// Every cluster contains a single page of column 0 that holds 25 floats, i.e. 100 bytes once unzipped
+   explicit RPageSourceMock(const ROOT::Experimental::RNTupleReadOptions &options = {})
+      : RPageSource("test", options)
+   {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
-      descBuilder.AddCluster(0, RNTupleVersion(), 0, ClusterSize_t(1));
-      descBuilder.AddCluster(1, RNTupleVersion(), 1, ClusterSize_t(1));
-      descBuilder.AddCluster(2, RNTupleVersion(), 2, ClusterSize_t(1));
-      descBuilder.AddCluster(3, RNTupleVersion(), 3, ClusterSize_t(1));
-      descBuilder.AddCluster(4, RNTupleVersion(), 4, ClusterSize_t(1));
+      descBuilder.AddColumn(0, 0, RNTupleVersion(),
+                            ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal32, false), 0);
+      for (unsigned i = 0; i < 5; ++i) {
+         descBuilder.AddCluster(i, RNTupleVersion(), i, ClusterSize_t(1));
+         ROOT::Experimental::RClusterDescriptor::RColumnRange columnRange;
+         columnRange.fColumnId = 0;
+         columnRange.fFirstElementIndex = 25 * i;
+         columnRange.fNElements = 25;
+         descBuilder.AddClusterColumnRange(i, columnRange);
+         ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+         pageRange.fColumnId = 0;
+         ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+         pageInfo.fNElements = 25;
+         pageInfo.fLocator.fBytesOnStorage = 10;
+         pageRange.fPageInfos.emplace_back(pageInfo);
+         descBuilder.AddClusterPageRange(i, std::move(pageRange));
+      }
       fDescriptor = descBuilder.MoveDescriptor();
    }
    std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
@@ -288,6 +305,120 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, EntryRanges)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetEntryRanges({{0, 1}, {3, 1}});
+   RPageSourceMock p1(options);
+   {
+      RClusterPool c1(p1, 4);
+      c1.GetCluster(0, {0});
+   }
+   // Clusters 1 and 2 are skipped, cluster 4 is outside the entry ranges
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(3U, p1.fReqsClusterIds[1]);
+
+   // An explicitly requested cluster is loaded even if it is outside the entry ranges
+   RPageSourceMock p2(options);
+   {
+      RClusterPool c2(p2, 2);
+      c2.GetCluster(1, {0});
+   }
+   ASSERT_EQ(2U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p2.fReqsClusterIds[0]);
+   EXPECT_EQ(3U, p2.fReqsClusterIds[1]);
+}
+
+
+TEST(ClusterPool, MemoryBudget)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseAdaptiveClusterWindow(false);
+   options.SetClusterCacheMemoryBudget(250);
+   RPageSourceMock p1(options);
+   {
+      RClusterPool c1(p1, 4);
+      c1.GetCluster(0, {0});
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p1.fReqsClusterIds[1]);
+
+   // The budget, not the pool size, limits the window
+   options.SetClusterCacheMemoryBudget(1000);
+   RPageSourceMock p2(options);
+   {
+      RClusterPool c2(p2, 1);
+      c2.GetCluster(1, {0});
+      c2.GetCluster(2, {0});
+   }
+   ASSERT_EQ(4U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i + 1, p2.fReqsClusterIds[i]);
+
+   // The requested cluster is loaded even if it exceeds the budget
+   options.SetClusterCacheMemoryBudget(1);
+   RPageSourceMock p3(options);
+   {
+      RClusterPool c3(p3, 4);
+      c3.GetCluster(3, {0});
+   }
+   ASSERT_EQ(1U, p3.fReqsClusterIds.size());
+   EXPECT_EQ(3U, p3.fReqsClusterIds[0]);
+
+   // The look-back window only keeps the clusters that fit in the budget left by the look-ahead window
+   options.SetClusterCacheMemoryBudget(200);
+   RPageSourceMock p4(options);
+   {
+      RClusterPool c4(p4, 3);
+      EXPECT_EQ(1U, c4.GetWindowPre());
+      c4.GetCluster(1, {0});
+      c4.GetCluster(2, {0});
+      c4.GetCluster(1, {0});
+   }
+   ASSERT_EQ(4U, p4.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p4.fReqsClusterIds[0]);
+   EXPECT_EQ(2U, p4.fReqsClusterIds[1]);
+   EXPECT_EQ(3U, p4.fReqsClusterIds[2]);
+   EXPECT_EQ(1U, p4.fReqsClusterIds[3]);
+
+   options.SetClusterCacheMemoryBudget(1000);
+   RPageSourceMock p5(options);
+   {
+      RClusterPool c5(p5, 3);
+      c5.GetCluster(1, {0});
+      c5.GetCluster(2, {0});
+      c5.GetCluster(1, {0});
+   }
+   ASSERT_EQ(4U, p5.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i + 1, p5.fReqsClusterIds[i]);
+}
+
+
+TEST(ClusterPool, AdaptiveWindow)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   EXPECT_FALSE(options.GetUseAdaptiveClusterWindow());
+   options.SetUseAdaptiveClusterWindow(true);
+   RPageSourceMock p1(options);
+   {
+      RClusterPool c1(p1, 4);
+      EXPECT_EQ(c1.GetWindowPost(), c1.GetWindowAhead());
+      for (unsigned i = 0; i < 5; ++i) {
+         c1.GetCluster(i, {0});
+         EXPECT_LE(1U, c1.GetWindowAhead());
+         EXPECT_GE(c1.GetWindowPost(), c1.GetWindowAhead());
+      }
+   }
+   // Clusters scheduled by a window that shrinks later on are kept, so that no cluster is requested twice
+   std::set<ROOT::Experimental::DescriptorId_t> uniqueIds(p1.fReqsClusterIds.begin(), p1.fReqsClusterIds.end());
+   EXPECT_EQ(uniqueIds.size(), p1.fReqsClusterIds.size());
+   EXPECT_EQ(5U, p1.fReqsClusterIds.size());
+}
+
+
 TEST(PageStorageFile, LoadCluster)
 {
    FileRaii fileGuard("test_ntuple_clusters.root");
@@ -331,3 +462,59 @@ TEST(PageStorageFile, LoadCluster)
    ROnDiskPage::Key key(colId, 0);
    EXPECT_NE(nullptr, cluster->GetOnDiskPage(key));
 }
+
+
+TEST(PageStorageFile, LoadClusters)
+{
+   FileRaii fileGuard("test_ntuple_load_clusters.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetCompression(0);
+   {
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), options));
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         ntuple.Fill();
+         ntuple.CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+
+   auto ptId = source.GetDescriptor().FindFieldId("pt");
+   auto colId = source.GetDescriptor().FindColumnId(ptId, 0);
+   auto column = std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+      ROOT::Experimental::Detail::RColumn::Create<float, ROOT::Experimental::EColumnType::kReal32>(
+         ROOT::Experimental::RColumnModel(ROOT::Experimental::EColumnType::kReal32, false), 0));
+   column->Connect(ptId, &source);
+
+   std::vector<RPageSource::RClusterKey> clusterKeys(3);
+   for (unsigned i = 0; i < 3; ++i) {
+      clusterKeys[i].fClusterId = 2 - i;
+      clusterKeys[i].fColumns = {colId};
+   }
+   auto clusters = source.LoadClusters(clusterKeys);
+   ASSERT_EQ(3U, clusters.size());
+   // All the clusters' pages are fetched by a single vector read
+   EXPECT_EQ(1, source.GetMetrics().GetCounter("RPageSourceFile.nReadV")->GetValueAsInt());
+   EXPECT_EQ(3, source.GetMetrics().GetCounter("RPageSourceFile.nClusterLoaded")->GetValueAsInt());
+
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(2U - i, clusters[i]->GetId());
+      ASSERT_EQ(1U, clusters[i]->GetNOnDiskPages());
+      auto onDiskPage = clusters[i]->GetOnDiskPage(ROnDiskPage::Key(colId, 0));
+      ASSERT_NE(nullptr, onDiskPage);
+      ASSERT_EQ(sizeof(float), onDiskPage->GetSize());
+      float pt;
+      memcpy(&pt, onDiskPage->GetAddress(), sizeof(float));
+      EXPECT_FLOAT_EQ(float(2 - i), pt);
+   }
+}
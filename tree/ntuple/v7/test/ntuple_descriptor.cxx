@@ -417,3 +417,112 @@ TEST(RColumnDescriptorIterable, IterateOverColumns)
    }
    EXPECT_EQ(3, counter);
 }
+
+TEST(RNTuple, ValueRanges)
+{
+   FileRaii fileGuard("test_ntuple_value_ranges.root");
+
+   for (auto useBufferedWrite : {false, true}) {
+      {
+         auto model = RNTupleModel::Create();
+         auto fieldPt = model->MakeField<float>("pt");
+         auto fieldId = model->MakeField<std::uint64_t>("id");
+         auto fieldJets = model->MakeField<std::vector<float>>("jets");
+         RNTupleWriteOptions options;
+         options.SetNElementsPerPage(100);
+         options.SetUseBufferedWrite(useBufferedWrite);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+         for (int i = 0; i < 1000; ++i) {
+            *fieldPt = i;
+            *fieldId = (std::uint64_t(1) << 63) + i;
+            *fieldJets = std::vector<float>((i < 500) ? 1 : 3, i);
+            ntuple->Fill();
+            if (i == 499)
+               ntuple->CommitCluster();
+         }
+      }
+
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      ASSERT_EQ(2U, desc.GetNClusters());
+
+      const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      const auto &columnRange = desc.GetClusterDescriptor(0).GetColumnRange(ptColumnId);
+      EXPECT_TRUE(columnRange.fValueRange.fIsValid);
+      EXPECT_EQ(0.0, columnRange.fValueRange.fMin);
+      EXPECT_EQ(499.0, columnRange.fValueRange.fMax);
+      const auto &pageInfos = desc.GetClusterDescriptor(1).GetPageRange(ptColumnId).fPageInfos;
+      ASSERT_EQ(5U, pageInfos.size());
+      EXPECT_EQ(600.0, pageInfos[1].fValueRange.fMin);
+      EXPECT_EQ(699.0, pageInfos[1].fValueRange.fMax);
+
+      // Top-level fields are pruned page by page
+      auto ranges = ntuple->FindEntryRanges("pt", 250, 349.5);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(200U, ranges[0].fFirstEntry);
+      EXPECT_EQ(200U, ranges[0].fNEntries);
+      EXPECT_TRUE(ntuple->FindEntryRanges("pt", 1000, 2000).empty());
+
+      // Unsigned integers are not mistaken for negative numbers
+      EXPECT_TRUE(ntuple->FindEntryRanges("id", -1, 1).empty());
+      ranges = ntuple->FindEntryRanges("id", 9e18, 1e19);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(1000U, ranges[0].fNEntries);
+
+      // Collections are pruned by their size
+      ranges = ntuple->FindEntryRanges("jets", 2, 3);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(500U, ranges[0].fFirstEntry);
+      EXPECT_EQ(500U, ranges[0].fNEntries);
+
+      // Nested fields are pruned cluster by cluster
+      DescriptorId_t jetsItemId = ROOT::Experimental::kInvalidDescriptorId;
+      for (const auto &f : desc.GetFieldIterable(desc.FindFieldId("jets")))
+         jetsItemId = f.GetId();
+      ranges = desc.FindEntryRanges(jetsItemId, 0, 10);
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(0U, ranges[0].fFirstEntry);
+      EXPECT_EQ(500U, ranges[0].fNEntries);
+
+      EXPECT_THROW(ntuple->FindEntryRanges("nonexistent", 0, 1), RException);
+   }
+}
+
+TEST(RNTuple, NoValueRanges)
+{
+   FileRaii fileGuard("test_ntuple_no_value_ranges.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetNElementsPerPage(100);
+      options.SetUsePageStatistics(false);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_FALSE(desc.GetClusterDescriptor(0).GetColumnRange(ptColumnId).fValueRange.fIsValid);
+   for (const auto &pageInfo : desc.GetClusterDescriptor(0).GetPageRange(ptColumnId).fPageInfos)
+      EXPECT_FALSE(pageInfo.fValueRange.fIsValid);
+
+   // Nothing is pruned
+   auto ranges = ntuple->FindEntryRanges("pt", 1000, 2000);
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(1000U, ranges[0].fNEntries);
+
+   // Without value ranges, the footer keeps the layout of version 0
+   auto footer = std::make_unique<unsigned char[]>(desc.GetFooterSize());
+   desc.SerializeFooter(footer.get());
+   std::uint16_t versionAtWrite;
+   std::uint16_t versionMin;
+   memcpy(&versionAtWrite, footer.get(), sizeof(versionAtWrite));
+   memcpy(&versionMin, footer.get() + sizeof(versionAtWrite), sizeof(versionMin));
+   EXPECT_EQ(0U, versionAtWrite);
+   EXPECT_EQ(0U, versionMin);
+}
@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <TFileMerger.h>
+
 namespace {
 
 // Reads an integer from a little-endian 4 byte buffer
@@ -80,3 +82,140 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+
+namespace {
+
+/// Writes an ntuple with the given compression whose entries carry the values [first, first + nEntries)
+void WriteMergeInput(const std::string &path, int first, int nEntries, int compression, bool useSplitEncoding = false)
+{
+   auto model = RNTupleModel::Create();
+   auto fieldFoo = model->MakeField<int>("foo");
+   auto fieldBar = model->MakeField<std::vector<float>>("bar");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   options.SetNEntriesPerCluster(5);
+   options.SetUseSplitEncoding(useSplitEncoding);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+   for (int i = first; i < first + nEntries; ++i) {
+      *fieldFoo = i;
+      *fieldBar = std::vector<float>(i % 3, static_cast<float>(i));
+      ntuple->Fill();
+   }
+}
+
+/// Merges the input files into the output file with the given compression
+void MergeFiles(const std::vector<std::string> &inputs, const std::string &output, int compression)
+{
+   std::vector<std::unique_ptr<RPageSource>> sources;
+   std::vector<RPageSource *> sourcePtrs;
+   for (const auto &path : inputs) {
+      sources.emplace_back(std::make_unique<RPageSourceFile>("ntuple", path, RNTupleReadOptions()));
+      sourcePtrs.emplace_back(sources.back().get());
+   }
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", output, options);
+   RNTupleMerger merger;
+   merger.Merge(sourcePtrs, *destination);
+}
+
+void CheckMergedNTuple(const std::string &path, int nEntries)
+{
+   auto ntuple = RNTupleReader::Open("ntuple", path);
+   ASSERT_EQ(static_cast<NTupleSize_t>(nEntries), ntuple->GetNEntries());
+   auto viewFoo = ntuple->GetView<int>("foo");
+   auto viewBar = ntuple->GetView<std::vector<float>>("bar");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<int>(i), viewFoo(i));
+      EXPECT_EQ(std::vector<float>(i % 3, static_cast<float>(i)), viewBar(i));
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, MergeSealedPages)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   WriteMergeInput(fileGuard1.GetPath(), 0, 12, 505);
+   WriteMergeInput(fileGuard2.GetPath(), 12, 8, 505);
+   MergeFiles({fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuard3.GetPath(), 505);
+
+   CheckMergedNTuple(fileGuard3.GetPath(), 20);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   // The clustering of the inputs is preserved: 3 + 2 clusters
+   EXPECT_EQ(5U, ntuple->GetDescriptor().GetNClusters());
+}
+
+TEST(RNTupleMerger, MergeRecompress)
+{
+   FileRaii fileGuard1("test_ntuple_merge_recompress_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_recompress_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_recompress_out.root");
+
+   WriteMergeInput(fileGuard1.GetPath(), 0, 10, 0);
+   WriteMergeInput(fileGuard2.GetPath(), 10, 10, 101);
+   MergeFiles({fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuard3.GetPath(), 505);
+
+   CheckMergedNTuple(fileGuard3.GetPath(), 20);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   for (const auto &clusterDesc : ntuple->GetDescriptor().GetClusterIterable()) {
+      for (auto columnId : clusterDesc.GetColumnIds())
+         EXPECT_EQ(505, clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+   }
+}
+
+TEST(RNTupleMerger, MergeReencode)
+{
+   FileRaii fileGuard1("test_ntuple_merge_reencode_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_reencode_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_reencode_out.root");
+
+   WriteMergeInput(fileGuard1.GetPath(), 0, 10, 505, true /* useSplitEncoding */);
+   WriteMergeInput(fileGuard2.GetPath(), 10, 10, 505);
+   MergeFiles({fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuard3.GetPath(), 505);
+
+   CheckMergedNTuple(fileGuard3.GetPath(), 20);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   EXPECT_EQ(EColumnType::kInt32, desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId("foo"), 0))
+                                     .GetModel().GetType());
+}
+
+TEST(RNTupleMerger, MergeIncompatible)
+{
+   FileRaii fileGuard1("test_ntuple_merge_incompatible_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_incompatible_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_incompatible_out.root");
+
+   WriteMergeInput(fileGuard1.GetPath(), 0, 10, 0);
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldFoo = model->MakeField<float>("foo");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+   EXPECT_THROW(MergeFiles({fileGuard1.GetPath(), fileGuard2.GetPath()}, fileGuard3.GetPath(), 0), RException);
+}
+
+TEST(RNTupleMerger, TFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_merge_hadd_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_hadd_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_hadd_out.root");
+
+   WriteMergeInput(fileGuard1.GetPath(), 0, 7, 101);
+   WriteMergeInput(fileGuard2.GetPath(), 7, 7, 101);
+   {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE", 101);
+      merger.AddFile(fileGuard1.GetPath().c_str());
+      merger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(merger.Merge());
+   }
+
+   CheckMergedNTuple(fileGuard3.GetPath(), 14);
+}
@@ -201,7 +201,7 @@ TEST(MiniFile, FailOnForwardIncompatibility)
    RMiniFileReader reader(rawFile.get());
    auto ntuple = reader.GetNTuple("ntuple").Inspect();
    // Construct incompatible version numbers in little-endian binary format
-   std::uint16_t futureVersion = RNTupleDescriptor::kFrameVersionMin + 1;
+   std::uint16_t futureVersion = RNTupleDescriptor::kFrameVersionCurrent + 1;
    unsigned char futureVersionLE[2];
    futureVersionLE[0] = (futureVersion & 0x00FF);
    futureVersionLE[1] = (futureVersion & 0xFF00) >> 8;
@@ -1,5 +1,8 @@
 #include "ntuple_test.hxx"
 
+#include <cmath>
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +35,157 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, HalfPrecision)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> element(nullptr);
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+   EXPECT_FALSE(element.IsMappable());
+
+   float in[] = {0.0, -0.0, 1.0, -2.5, 0.333251953125, 65504.0, 65520.0, -1e9, 1e-10, 5.9604644775390625e-08,
+                 std::numeric_limits<float>::infinity()};
+   const std::size_t n = sizeof(in) / sizeof(in[0]);
+   std::uint16_t packed[n];
+   element.Pack(packed, in, n);
+   EXPECT_EQ(0x0000, packed[0]);
+   EXPECT_EQ(0x8000, packed[1]);
+   EXPECT_EQ(0x3C00, packed[2]);
+   EXPECT_EQ(0x7C00, packed[6]);
+
+   float out[n];
+   element.Unpack(out, packed, n);
+   for (std::size_t i = 0; i < 6; ++i)
+      EXPECT_EQ(in[i], out[i]);
+   EXPECT_TRUE(std::isinf(out[6]));
+   EXPECT_TRUE(std::isinf(out[7]) && (out[7] < 0));
+   EXPECT_EQ(0.0, out[8]);
+   // Smallest subnormal half precision number
+   EXPECT_EQ(in[9], out[9]);
+   EXPECT_TRUE(std::isinf(out[10]));
+
+   float nan = std::numeric_limits<float>::quiet_NaN();
+   element.Pack(packed, &nan, 1);
+   element.Unpack(out, packed, 1);
+   EXPECT_TRUE(std::isnan(out[0]));
+}
+
+TEST(Packing, Split)
+{
+   using ROOT::Experimental::Detail::RColumnElement;
+
+   RColumnElement<std::int32_t, EColumnType::kSplitInt32> elementInt32(nullptr);
+   std::int32_t int32In[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::max(),
+                             std::numeric_limits<std::int32_t>::min()};
+   unsigned char int32Packed[sizeof(int32In)];
+   elementInt32.Pack(int32Packed, int32In, 6);
+   // Zigzag encoded, the least significant bytes come first
+   EXPECT_EQ(0, int32Packed[0]);
+   EXPECT_EQ(1, int32Packed[1]);
+   EXPECT_EQ(2, int32Packed[2]);
+   EXPECT_EQ(3, int32Packed[3]);
+   EXPECT_EQ(0, int32Packed[6 + 1]);
+   std::int32_t int32Out[6];
+   elementInt32.Unpack(int32Out, int32Packed, 6);
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(int32In[i], int32Out[i]);
+
+   RColumnElement<std::int64_t, EColumnType::kSplitInt64> elementInt64(nullptr);
+   std::int64_t int64In[] = {0, -42, 42, std::numeric_limits<std::int64_t>::max(),
+                             std::numeric_limits<std::int64_t>::min()};
+   unsigned char int64Packed[sizeof(int64In)];
+   elementInt64.Pack(int64Packed, int64In, 5);
+   std::int64_t int64Out[5];
+   elementInt64.Unpack(int64Out, int64Packed, 5);
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_EQ(int64In[i], int64Out[i]);
+
+   RColumnElement<float, EColumnType::kSplitReal32> elementReal32(nullptr);
+   float real32In[] = {0.0, -1.0, 3.14159f, std::numeric_limits<float>::max(), std::numeric_limits<float>::min()};
+   unsigned char real32Packed[sizeof(real32In)];
+   elementReal32.Pack(real32Packed, real32In, 5);
+   float real32Out[5];
+   elementReal32.Unpack(real32Out, real32Packed, 5);
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_EQ(real32In[i], real32Out[i]);
+
+   RColumnElement<double, EColumnType::kSplitReal64> elementReal64(nullptr);
+   double real64In[] = {0.0, -1.0, 2.718281828, std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest()};
+   unsigned char real64Packed[sizeof(real64In)];
+   elementReal64.Pack(real64Packed, real64In, 5);
+   double real64Out[5];
+   elementReal64.Unpack(real64Out, real64Packed, 5);
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_EQ(real64In[i], real64Out[i]);
+
+   RColumnElement<ClusterSize_t, EColumnType::kSplitIndex> elementIndex(nullptr);
+   ClusterSize_t indexIn[] = {ClusterSize_t(3), ClusterSize_t(3), ClusterSize_t(7), ClusterSize_t(1000000)};
+   unsigned char indexPacked[sizeof(indexIn)];
+   elementIndex.Pack(indexPacked, indexIn, 4);
+   // Delta encoded
+   EXPECT_EQ(3, indexPacked[0]);
+   EXPECT_EQ(0, indexPacked[1]);
+   EXPECT_EQ(4, indexPacked[2]);
+   ClusterSize_t indexOut[4];
+   elementIndex.Unpack(indexOut, indexPacked, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(indexIn[i], indexOut[i]);
+
+   EXPECT_EQ(EColumnType::kSplitIndex,
+             ROOT::Experimental::Detail::RColumnElementBase::GetSplitType(EColumnType::kIndex));
+   EXPECT_EQ(EColumnType::kUnknown, ROOT::Experimental::Detail::RColumnElementBase::GetSplitType(EColumnType::kBit));
+}
+
+TEST(Packing, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldInt32 = model->MakeField<std::int32_t>("int32");
+      auto fieldInt64 = model->MakeField<std::int64_t>("int64");
+      auto fieldDouble = model->MakeField<double>("double");
+      auto fieldVec = model->MakeField<std::vector<float>>("vec");
+      auto halfField = std::make_unique<RField<float>>("half");
+      halfField->SetHalfPrecision();
+      model->AddField(std::move(halfField));
+      auto entry = model->GetDefaultEntry();
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      options.SetNElementsPerPage(7);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *fieldInt32 = -i;
+         *fieldInt64 = static_cast<std::int64_t>(i) << 40;
+         *fieldDouble = i / 3.0;
+         *fieldVec = std::vector<float>(i % 4, static_cast<float>(i));
+         *entry->Get<float>("half") = i + 0.5f;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto fnColumnType = [&desc](const std::string &fieldName, unsigned int columnIndex) {
+      return desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId(fieldName), columnIndex)).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kSplitInt32, fnColumnType("int32", 0));
+   EXPECT_EQ(EColumnType::kSplitInt64, fnColumnType("int64", 0));
+   EXPECT_EQ(EColumnType::kSplitReal64, fnColumnType("double", 0));
+   EXPECT_EQ(EColumnType::kSplitIndex, fnColumnType("vec", 0));
+   EXPECT_EQ(EColumnType::kSplitReal32, fnColumnType("vec._0", 0));
+   EXPECT_EQ(EColumnType::kReal16, fnColumnType("half", 0));
+
+   auto viewInt32 = ntuple->GetView<std::int32_t>("int32");
+   auto viewInt64 = ntuple->GetView<std::int64_t>("int64");
+   auto viewDouble = ntuple->GetView<double>("double");
+   auto viewVec = ntuple->GetView<std::vector<float>>("vec");
+   auto viewHalf = ntuple->GetView<float>("half");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(-static_cast<std::int32_t>(i), viewInt32(i));
+      EXPECT_EQ(static_cast<std::int64_t>(i) << 40, viewInt64(i));
+      EXPECT_EQ(i / 3.0, viewDouble(i));
+      EXPECT_EQ(std::vector<float>(i % 4, static_cast<float>(i)), viewVec(i));
+      EXPECT_EQ(i + 0.5f, viewHalf(i));
+   }
+}
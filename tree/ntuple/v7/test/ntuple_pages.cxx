@@ -12,6 +12,41 @@ TEST(Pages, Allocation)
    allocator.DeletePage(page);
 }
 
+TEST(Pages, Arena)
+{
+   EXPECT_EQ(64U, RPageAllocatorArena::GetBlockSize(1));
+   EXPECT_EQ(64U, RPageAllocatorArena::GetBlockSize(64));
+   EXPECT_EQ(80U, RPageAllocatorArena::GetBlockSize(65));
+   EXPECT_EQ(128U, RPageAllocatorArena::GetBlockSize(128));
+   EXPECT_EQ(160U, RPageAllocatorArena::GetBlockSize(129));
+   EXPECT_EQ(1280U * 1024U, RPageAllocatorArena::GetBlockSize(1024 * 1024 + 1));
+
+   RPageAllocatorArena arena(1000);
+   arena.GetMetrics().Enable();
+   auto page = arena.NewPage(42, 4, 16);
+   EXPECT_FALSE(page.IsNull());
+   EXPECT_EQ(64U, page.GetCapacity());
+   auto buffer = page.GetBuffer();
+   arena.DeletePage(page);
+   EXPECT_EQ(64U, arena.GetSzRetained());
+
+   // Same size class: the buffer is recycled
+   page = arena.NewPage(42, 8, 7);
+   EXPECT_EQ(buffer, page.GetBuffer());
+   EXPECT_EQ(0U, arena.GetSzRetained());
+   arena.DeletePage(page);
+
+   // Exceeds the retained memory limit: the buffer is freed
+   auto large = arena.Allocate(2000);
+   arena.Release(large, 2000);
+   EXPECT_EQ(64U, arena.GetSzRetained());
+
+   EXPECT_EQ(2, arena.GetMetrics().GetCounter("RPageAllocatorArena.nAllocated")->GetValueAsInt());
+   EXPECT_EQ(64 + 2048, arena.GetMetrics().GetCounter("RPageAllocatorArena.szAllocated")->GetValueAsInt());
+   EXPECT_EQ(1, arena.GetMetrics().GetCounter("RPageAllocatorArena.nReused")->GetValueAsInt());
+   EXPECT_EQ(64, arena.GetMetrics().GetCounter("RPageAllocatorArena.szReused")->GetValueAsInt());
+}
+
 TEST(Pages, Pool)
 {
    RPagePool pool;
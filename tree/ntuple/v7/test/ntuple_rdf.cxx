@@ -35,3 +35,95 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(2U, *rdf.Min("__rdf_sizeof_jets"));
    EXPECT_EQ(3U, *rdf.Min("__rdf_sizeof_klass.v1"));
 }
+
+TEST(RNTuple, RDFSelectRange)
+{
+   FileRaii fileGuard("test_ntuple_rdf_select_range.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldEta = model->MakeField<float>("eta");
+      RNTupleWriteOptions options;
+      options.SetNElementsPerPage(100);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *fieldPt = i;
+         *fieldEta = -i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(
+      ROOT::Experimental::Detail::RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds->SelectRange("pt", 250, 450);
+   ds->SelectRange("eta", -320, -300);
+   ROOT::RDataFrame rdf(std::move(ds));
+   // Only the page with the entries [300, 400) passes both selections
+   EXPECT_EQ(100U, *rdf.Count());
+   EXPECT_EQ(21U, *rdf.Filter("pt >= 300 && pt <= 320").Count());
+}
+
+TEST(RNTuple, RDFSnapshot)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot.root");
+   FileRaii fileGuardJitted("test_ntuple_rdf_snapshot_jitted.root");
+
+   ROOT::RDF::RSnapshotOptions options;
+   options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   options.fAutoFlush = 100;
+   auto df = ROOT::RDataFrame(1000)
+                .Define("x", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"})
+                .Define("v", [](int x) { return ROOT::VecOps::RVec<float>(x % 3, x); }, {"x"});
+   auto snapshot =
+      df.Snapshot<int, ROOT::VecOps::RVec<float>>("ntuple", fileGuard.GetPath(), {"x", "v"}, options);
+
+   // The returned data frame reads the written ntuple
+   EXPECT_EQ(1000U, *snapshot->Count());
+   EXPECT_DOUBLE_EQ(499500., *snapshot->Sum<int>("x"));
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(1000U, ntuple->GetNEntries());
+   auto viewX = ntuple->GetView<int>("x");
+   auto viewV = ntuple->GetView<ROOT::VecOps::RVec<float>>("v");
+   for (auto i : ntuple->GetEntryRange()) {
+      // In multi-thread runs, clusters of entries are written in an undefined order
+      const auto x = viewX(i);
+      EXPECT_EQ(static_cast<std::size_t>(x % 3), viewV(i).size());
+      for (auto v : viewV(i))
+         EXPECT_EQ(static_cast<float>(x), v);
+   }
+
+   // Column types are inferred
+   auto jitted = df.Filter("x % 2 == 0").Snapshot("ntuple", fileGuardJitted.GetPath(), {"x", "v"}, options);
+   EXPECT_EQ(500U, *jitted->Count());
+   EXPECT_DOUBLE_EQ(249500., *jitted->Sum<int>("x"));
+}
+
+TEST(RNTuple, RDFSnapshotLazy)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot_lazy.root");
+
+   ROOT::RDF::RSnapshotOptions options;
+   options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   options.fLazy = true;
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"});
+   // The output ntuple is only opened once the returned data frame is used, i.e. after it is written
+   auto snapshot = df.Snapshot<int>("ntuple", fileGuard.GetPath(), {"x"}, options);
+   EXPECT_EQ(0u, df.GetNRuns());
+   EXPECT_EQ(std::vector<std::string>{"x"}, snapshot->GetColumnNames());
+   EXPECT_EQ(1u, df.GetNRuns());
+   EXPECT_EQ(45, *snapshot->Sum<int>("x"));
+}
+
+TEST(RNTuple, RDFSnapshotUnsupportedType)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot_unsupported.root");
+
+   ROOT::RDF::RSnapshotOptions options;
+   options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   // RNTuple has no field for unsigned long long: the snapshot compiles, but throws
+   ROOT::RDataFrame df(1);
+   EXPECT_THROW(df.Snapshot<unsigned long long>("ntuple", fileGuard.GetPath(), {"rdfentry_"}, options),
+                std::runtime_error);
+}
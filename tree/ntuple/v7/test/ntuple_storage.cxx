@@ -165,3 +165,212 @@ TEST(RPageSinkBuf, Basics)
       ASSERT_EQ(column, next_page->first);
    }
 }
+
+namespace {
+
+/// Runs the scheduled tasks only on Wait() and in reverse order, in order to verify that the page order on disk
+/// does not depend on the order in which the sealing tasks finish
+class RReverseTaskScheduler : public RPageStorage::RTaskScheduler {
+private:
+   std::vector<std::function<void(void)>> fTasks;
+
+public:
+   unsigned int fNTasks = 0;
+   void Reset() final { fTasks.clear(); }
+   void AddTask(const std::function<void(void)> &taskFunc) final { fTasks.emplace_back(taskFunc); }
+   void Wait() final
+   {
+      for (auto itr = fTasks.rbegin(); itr != fTasks.rend(); ++itr) {
+         (*itr)();
+         fNTasks++;
+      }
+      fTasks.clear();
+   }
+};
+
+} // anonymous namespace
+
+TEST(RPageSinkBuf, ParallelZip)
+{
+   FileRaii fileGuard("test_ntuple_sinkbuf_parallel_zip.root");
+
+   RReverseTaskScheduler taskScheduler;
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<std::vector<std::int64_t>>("vec");
+      RNTupleWriteOptions options;
+      options.SetNElementsPerPage(1000);
+      auto sink = std::make_unique<RPageSinkBuf>(std::make_unique<RPageSinkFile>("ntuple", fileGuard.GetPath(),
+                                                                                  options));
+      sink->SetTaskScheduler(&taskScheduler);
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::move(sink));
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 20000; i++) {
+         *fieldPt = static_cast<float>(i);
+         *fieldVec = std::vector<std::int64_t>(i % 3, i);
+         ntuple->Fill();
+         if (i && i % 15000 == 0)
+            ntuple->CommitCluster();
+      }
+      ntuple->CommitCluster();
+      EXPECT_EQ(1, ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.parallelZip")->GetValueAsInt());
+      EXPECT_NE(nullptr, ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.timeWallZipColumn0"));
+   }
+   EXPECT_GT(taskScheduler.fNTasks, 3U);
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(20000U, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int64_t>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int64_t>(i % 3, i), viewVec(i));
+   }
+
+   // Pages are written ordered by column and page number
+   const auto &desc = ntuple->GetDescriptor();
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      std::int64_t lastPosition = -1;
+      for (DescriptorId_t columnId = 0; columnId < desc.GetNColumns(); ++columnId) {
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            EXPECT_GT(static_cast<std::int64_t>(pageInfo.fLocator.fPosition), lastPosition);
+            lastPosition = pageInfo.fLocator.fPosition;
+         }
+      }
+   }
+}
+
+TEST(RNTupleThreadPoolTaskScheduler, Basics)
+{
+   ROOT::Experimental::RNTupleThreadPoolTaskScheduler taskScheduler(3);
+   EXPECT_EQ(3U, taskScheduler.GetNThreads());
+
+   std::atomic<int> counter(0);
+   for (int i = 0; i < 2; ++i) {
+      taskScheduler.Reset();
+      for (int j = 0; j < 100; ++j)
+         taskScheduler.AddTask([&counter]() { counter++; });
+      taskScheduler.Wait();
+      EXPECT_EQ((i + 1) * 100, counter.load());
+   }
+   // Waiting without tasks does not block
+   taskScheduler.Reset();
+   taskScheduler.Wait();
+}
+
+TEST(RNTuple, UnzipThreads)
+{
+   FileRaii fileGuard("test_ntuple_unzip_threads.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetNElementsPerPage(1000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 20000; i++) {
+         *fieldPt = static_cast<float>(i);
+         ntuple->Fill();
+         if (i && i % 5000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetNUnzipThreads(2);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+   }
+   // Every loaded page is decompressed exactly once, no matter if by the unzip threads or on demand.  The cluster
+   // pool may load a cluster more than once, so the unzipped volume is only bounded from below.
+   const auto &metrics = ntuple->GetMetrics();
+   EXPECT_EQ(metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageLoaded")->GetValueAsInt(),
+             metrics.GetCounter("RNTupleReader.RPageSourceFile.nPagePopulated")->GetValueAsInt());
+   EXPECT_LE(static_cast<std::int64_t>(20000 * sizeof(float)),
+             metrics.GetCounter("RNTupleReader.RPageSourceFile.szUnzip")->GetValueAsInt());
+}
+
+TEST(RNTuple, PageArena)
+{
+   FileRaii fileGuard("test_ntuple_page_arena.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<std::vector<std::int64_t>>("vec");
+      RNTupleWriteOptions options;
+      options.SetNElementsPerPage(1000);
+      options.SetUsePageArena(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 20000; i++) {
+         *fieldPt = static_cast<float>(i);
+         *fieldVec = std::vector<std::int64_t>(i % 3, i);
+         ntuple->Fill();
+         if (i && i % 5000 == 0)
+            ntuple->CommitCluster();
+      }
+      ntuple->CommitCluster();
+      // The buffered sink's page copies are recycled from the second cluster on
+      EXPECT_LT(0, ntuple->GetMetrics()
+                      .GetCounter("RNTupleWriter.RPageSinkFile.RPageAllocatorArena.nReused")
+                      ->GetValueAsInt());
+   }
+
+   RNTupleReadOptions options;
+   options.SetUsePageArena(true);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int64_t>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int64_t>(i % 3, i), viewVec(i));
+   }
+   EXPECT_LT(0, ntuple->GetMetrics()
+                   .GetCounter("RNTupleReader.RPageSourceFile.RPageAllocatorArena.szAllocated")
+                   ->GetValueAsInt());
+}
+
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<std::vector<std::int64_t>>("vec");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetNElementsPerPage(1000);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 20000; i++) {
+         *fieldPt = static_cast<float>(i);
+         *fieldVec = std::vector<std::int64_t>(i % 3, i);
+         ntuple->Fill();
+         if (i && i % 5000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewVec = ntuple->GetView<std::vector<std::int64_t>>("vec");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(std::vector<std::int64_t>(i % 3, i), viewVec(i));
+      }
+      // Local files are mapped; pages are never read by means of system calls
+      const auto &metrics = ntuple->GetMetrics();
+      EXPECT_EQ(0, metrics.GetCounter("RNTupleReader.RPageSourceFile.nReadV")->GetValueAsInt());
+      EXPECT_EQ(0, metrics.GetCounter("RNTupleReader.RPageSourceFile.nRead")->GetValueAsInt());
+      EXPECT_LE(metrics.GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt(),
+                metrics.GetCounter("RNTupleReader.RPageSourceFile.nPagePopulated")->GetValueAsInt());
+   }
+}
@@ -132,6 +132,52 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, MapBulk)
+{
+   FileRaii fileGuard("test_ntuple_map_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetNElementsPerPage(eltsPerPage);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   EXPECT_TRUE(viewPt.MapBulk(0, 0).empty());
+
+   // Within a single page: zero-copy
+   NTupleSize_t nPageItems = 0;
+   auto buf = viewPt.MapV(10, nPageItems);
+   auto values = viewPt.MapBulk(10, 100);
+   EXPECT_EQ(buf, values.data());
+   ASSERT_EQ(100U, values.size());
+   for (NTupleSize_t i = 0; i < values.size(); i++) {
+      EXPECT_EQ(static_cast<float>(10 + i), values[i]);
+   }
+
+   // Across several pages: gathered in the view's buffer
+   auto gathered = viewPt.MapBulk(eltsPerPage - 5, 2 * eltsPerPage + 10);
+   ASSERT_EQ(2U * eltsPerPage + 10, gathered.size());
+   for (NTupleSize_t i = 0; i < gathered.size(); i++) {
+      EXPECT_EQ(static_cast<float>(eltsPerPage - 5 + i), gathered[i]) << i;
+   }
+
+   // The entire field
+   auto all = viewPt.MapBulk(0, 10'000);
+   ASSERT_EQ(10'000U, all.size());
+   for (NTupleSize_t i = 0; i < all.size(); i++) {
+      EXPECT_EQ(static_cast<float>(i), all[i]) << i;
+   }
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
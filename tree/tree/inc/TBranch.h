@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -111,6 +113,12 @@ protected:
    using BulkObj = ROOT::Experimental::Internal::TBulkBranchRead;
    static Int_t fgCount;          ///<! branch counter
    Int_t       fCompress;         ///<  Compression level and algorithm
+   Int_t       fCompressionDictSize = 0;       ///<  Size of fCompressionDict, 0 if the baskets use no dictionary
+   char       *fCompressionDict = nullptr;     ///<[fCompressionDictSize] ZSTD dictionary of the baskets
+   UInt_t      fCompressionDictID = 0;         ///<! ID of the registered fCompressionDict, 0 if none
+   Bool_t      fCompressionDictTrained = kFALSE; ///<! Whether training the dictionary was attempted
+   std::vector<char>  fDictSamples;            ///<! Content of the first baskets, to train the dictionary
+   std::vector<Int_t> fDictSampleSizes;        ///<! Sizes of the baskets in fDictSamples
    Int_t       fBasketSize;       ///<  Initial Size of  Basket Buffer
    Int_t       fEntryOffsetLen;   ///<  Initial Length of fEntryOffset table in the basket buffers
    Int_t       fWriteBasket;      ///<  Last basket number written
@@ -238,6 +246,8 @@ public:
            Long64_t  GetEntryNumber() const {return fEntryNumber;}
            Long64_t  GetFirstEntry()  const {return fFirstEntry; }
          TIOFeatures GetIOFeatures() const;
+   const char       *GetCompressionDictionary(Int_t &size) const;
+           UInt_t    UpdateCompressionDictionary(const char *buffer, Int_t size);
          TObjArray  *GetListOfBaskets()  {return &fBaskets;}
          TObjArray  *GetListOfBranches() {return &fBranches;}
          TObjArray  *GetListOfLeaves()   {return &fLeaves;}
@@ -271,6 +281,7 @@ public:
    void              SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    void              SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    void              SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
+   void              SetCompressionDictionary(const char *dict, Int_t size);
    virtual void      SetEntries(Long64_t entries);
    virtual void      SetEntryOffsetLen(Int_t len, Bool_t updateSubBranches = kFALSE);
    virtual void      SetFirstEntry( Long64_t entry );
@@ -288,7 +299,7 @@ public:
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
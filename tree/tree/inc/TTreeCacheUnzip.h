@@ -16,6 +16,7 @@
 #include "Bytes.h"
 #include "TTreeCache.h"
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -24,13 +25,17 @@ class TBranch;
 class TMutex;
 class TTree;
 
-#ifdef R__USE_IMT
 namespace ROOT {
+#ifdef R__USE_IMT
 namespace Experimental {
 class TTaskGroup;
 }
-}
 #endif
+namespace Internal {
+struct RUnzipReadAhead;
+class RUnzipWorkers;
+}
+}
 
 class TTreeCacheUnzip : public TTreeCache {
 
@@ -91,11 +96,18 @@ protected:
 #ifdef R__USE_IMT
    std::unique_ptr<ROOT::Experimental::TTaskGroup> fUnzipTaskGroup;
 #endif
+   std::unique_ptr<ROOT::Internal::RUnzipWorkers> fUnzipWorkers; ///<! Tasks run by the helper threads without IMT
+
+   // Read-ahead related members
+   std::unique_ptr<ROOT::Internal::RUnzipReadAhead> fReadAhead; ///<! Baskets of the clusters after the current one
+   Int_t       fReadAheadClusters; ///<! Number of clusters read ahead of the current one, 0 disables read-ahead
+
+   static UInt_t fgUnzipNThreads; ///< Number of helper threads, 0 lets the cache decide
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
-   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Long64_t    fUnzipBufferSize;  ///<!  Kept for backward compatibility, the unzipped blocks are no longer limited
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -104,6 +116,8 @@ protected:
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
    Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   Int_t       fNReadAhead;       ///<! number of blocks that were read ahead and found in the cache
+   Double_t    fStallTime;        ///<! time spent waiting for blocks being unzipped by other threads, in seconds
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &);            //this class cannot be copied
@@ -114,6 +128,10 @@ private:
 
    // Private methods
    void  Init();
+   void  CancelTasks();
+   Int_t GetReadAheadBuffer(char **buf, Long64_t pos, Bool_t *free);
+   void  ReadAhead();
+   void  RunTask(const std::function<void(void)> &task);
 
 public:
    TTreeCacheUnzip();
@@ -133,15 +151,18 @@ public:
    static Bool_t        IsParallelUnzip();
    static Int_t         SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option = TTreeCacheUnzip::kEnable);
 
+   static UInt_t        GetUnzipNThreads();
+   static void          SetUnzipNThreads(UInt_t nThreads = 0);
+
    // Unzipping related methods
-#ifdef R__USE_IMT
    Int_t          CreateTasks();
-#endif
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    virtual Int_t  GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free);
+   Int_t          GetReadAheadClusters() const { return fReadAheadClusters; }
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
    virtual void   ResetCache();
    virtual Int_t  SetBufferSize(Int_t buffersize);
+   void           SetReadAheadClusters(Int_t nClusters) { fReadAheadClusters = nClusters; }
    void           SetUnzipBufferSize(Long64_t bufferSize);
    void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
@@ -152,6 +173,9 @@ public:
    Int_t  GetNUnzip() { return fNUnzip; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNReadAhead() { return fNReadAhead; }
+   Int_t  GetNStalls() { return fNStalls; }
+   Double_t GetStallTime() { return fStallTime; }
 
    void Print(Option_t* option = "") const;
 
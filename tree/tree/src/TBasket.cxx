@@ -1012,6 +1012,7 @@ void TBasket::Streamer(TBuffer &b)
          // We currently believe that in all cases when offsets can be generated, then the
          // displacement array must be zero.
          assert(flag <= 40);
+         ResetEntryOffset(); // The offsets generated for the previous content of this basket
          fEntryOffset = reinterpret_cast<Int_t *>(-1);
       }
       if (flag == 1 || flag > 10) {
@@ -1230,6 +1231,17 @@ Int_t TBasket::WriteBuffer()
       char *bufcur = &fBuffer[fKeylen];
       noutot = 0;
       nzip   = 0;
+      // The first baskets train the dictionary of the branch, see TBranch::UpdateCompressionDictionary
+      UInt_t dictID = 0;
+      if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary) {
+#ifdef R__USE_IMT
+         sentry.unlock();
+#endif  // R__USE_IMT
+         dictID = fBranch->UpdateCompressionDictionary(objbuf, fObjlen);
+#ifdef R__USE_IMT
+         sentry.lock();
+#endif  // R__USE_IMT
+      }
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
@@ -1242,7 +1254,10 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (dictID)
+            R__zipZSTDWithDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, dictID);
+         else
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
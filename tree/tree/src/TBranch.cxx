@@ -40,6 +40,7 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TMath.h"
+#include "RZip.h"
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
@@ -53,6 +54,7 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -452,6 +454,8 @@ TBranch::~TBranch()
    delete fBrowsables;
    fBrowsables = 0;
 
+   SetCompressionDictionary(nullptr, 0);
+
    // Note: We do *not* have ownership of the buffer.
    fEntryBuffer = 0;
 
@@ -2732,6 +2736,84 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ZSTD dictionary used to compress the baskets of this branch and set
+/// `size` to its size; return nullptr if the baskets are compressed without dictionary.
+
+const char *TBranch::GetCompressionDictionary(Int_t &size) const
+{
+   size = fCompressionDictSize;
+   return fCompressionDict;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the ZSTD dictionary used to compress the baskets of this branch, see
+/// ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary. The dictionary is stored with
+/// the branch, and is needed to decompress the baskets compressed with it. A null `dict`
+/// removes the dictionary.
+
+void TBranch::SetCompressionDictionary(const char *dict, Int_t size)
+{
+   if (fCompressionDictID)
+      R__ZSTDReleaseDictionary(fCompressionDictID);
+   fCompressionDictID = 0;
+   delete [] fCompressionDict;
+   fCompressionDict = nullptr;
+   fCompressionDictSize = 0;
+   fDictSamples = std::vector<char>();
+   fDictSampleSizes = std::vector<Int_t>();
+   if (!dict || size <= 0)
+      return;
+
+   fCompressionDictTrained = kTRUE;
+   fCompressionDictID = R__ZSTDRegisterDictionary(dict, size);
+   if (!fCompressionDictID) {
+      Error("SetCompressionDictionary", "Cannot use the compression dictionary of branch %s", GetName());
+      return;
+   }
+   fCompressionDict = new char[size];
+   memcpy(fCompressionDict, dict, size);
+   fCompressionDictSize = size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ID of the dictionary to compress a basket of this branch with, 0 to
+/// compress it without dictionary. Called by TBasket::WriteBuffer with the uncompressed
+/// content of the basket when the compression algorithm is
+/// ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary: the content of the first
+/// baskets is kept to train the dictionary, used for all the following baskets.
+
+UInt_t TBranch::UpdateCompressionDictionary(const char *buffer, Int_t size)
+{
+   // Train once on 16 baskets or 256 kB, and use at most a tenth of that for the dictionary as recommended by ZSTD.
+   const std::size_t kTrainingBaskets = 16;
+   const std::size_t kTrainingBytes = 256 * 1024;
+   const Int_t kMinDictSize = 256;
+   const Int_t kMaxDictSize = 32 * 1024;
+
+   if (fCompressionDictTrained)
+      return fCompressionDictID;
+
+   fDictSamples.insert(fDictSamples.end(), buffer, buffer + size);
+   fDictSampleSizes.push_back(size);
+   if (fDictSampleSizes.size() < kTrainingBaskets && fDictSamples.size() < kTrainingBytes)
+      return 0;
+
+   fCompressionDictTrained = kTRUE;
+   const Int_t capacity = std::min<Int_t>(kMaxDictSize, fDictSamples.size() / 10);
+   std::vector<char> dict(std::max(capacity, kMinDictSize));
+   const Int_t dictSize = capacity < kMinDictSize
+                             ? 0
+                             : R__ZSTDTrainDictionary(dict.data(), capacity, fDictSamples.data(),
+                                                      fDictSampleSizes.data(), fDictSampleSizes.size());
+   if (dictSize > 0)
+      SetCompressionDictionary(dict.data(), dictSize);
+   // Either way, the samples are not needed anymore; without dictionary, the baskets are compressed with plain ZSTD
+   fDictSamples = std::vector<char>();
+   fDictSampleSizes = std::vector<Int_t>();
+   return fCompressionDictID;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
@@ -2888,7 +2970,16 @@ void TBranch::Streamer(TBuffer& b)
 
       Version_t v = b.ReadVersion(&R__s, &R__c);
       if (v > 9) {
+         SetCompressionDictionary(nullptr, 0);
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
+         if (fCompressionDictSize > 0) {
+            // Register the dictionary, needed to decompress the baskets
+            fCompressionDictTrained = kTRUE;
+            fCompressionDictID = R__ZSTDRegisterDictionary(fCompressionDict, fCompressionDictSize);
+            if (!fCompressionDictID)
+               Error("Streamer", "Cannot use the compression dictionary of branch %s: its baskets cannot be read",
+                     GetName());
+         }
 
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
@@ -544,6 +544,34 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the list contains at least one entry in [entrymin, entrymax],
+/// like TEventList::ContainsRange(). Only the blocks overlapping the range are
+/// looked at, see TEntryListBlock::ContainsRange(). As Contains() without a
+/// tree, it applies to the current sub-list if the list has sub-lists.
+
+Bool_t TEntryList::ContainsRange(Long64_t entrymin, Long64_t entrymax)
+{
+   if (entrymin < 0 || entrymin > entrymax)
+      return kFALSE;
+   if (fBlocks) {
+      for (Long64_t nblock = entrymin / kBlockSize; nblock <= entrymax / kBlockSize && nblock < fNBlocks; ++nblock) {
+         TEntryListBlock *block = (TEntryListBlock *)fBlocks->UncheckedAt(nblock);
+         const Long64_t blockStart = nblock * kBlockSize;
+         const Int_t min = TMath::Max(entrymin, blockStart) - blockStart;
+         const Int_t max = TMath::Min(entrymax, blockStart + kBlockSize - 1) - blockStart;
+         if (block->ContainsRange(min, max))
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+   if (fLists) {
+      if (!fCurrent) fCurrent = (TEntryList*)fLists->First();
+      return fCurrent->ContainsRange(entrymin, entrymax);
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
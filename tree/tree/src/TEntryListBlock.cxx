@@ -46,6 +46,8 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +238,45 @@ Int_t TEntryListBlock::Contains(Int_t entry)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// True if the block contains at least one entry in [entrymin, entrymax].
+/// Unlike calling Contains() for each entry, words of bits are tested at once
+/// and lists are searched by bisection.
+
+Bool_t TEntryListBlock::ContainsRange(Int_t entrymin, Int_t entrymax)
+{
+   if (entrymin < 0 || entrymax >= kBlockSize*16 || entrymin > entrymax) {
+      Error("ContainsRange", "Illegal entry range!\n");
+      return 0;
+   }
+   if (!fIndices)
+      return !fPassing;
+   if (fType==0){
+      //bits
+      for (Int_t entry = entrymin; entry <= entrymax;) {
+         if ((entry & 15) == 0 && entry + 15 <= entrymax) {
+            if (fIndices[entry>>4] != 0)
+               return kTRUE;
+            entry += 16;
+         } else {
+            if ((fIndices[entry>>4] & (1<<(entry & 15))) != 0)
+               return kTRUE;
+            ++entry;
+         }
+      }
+      return kFALSE;
+   }
+   //list, sorted
+   const UShort_t *begin = fIndices;
+   const UShort_t *end = fIndices + fNPassed;
+   const UShort_t *first = std::lower_bound(begin, end, entrymin);
+   if (fPassing)
+      return first != end && *first <= entrymax;
+   // the list holds the entries that do not pass: some entry of the range passes unless they are all listed
+   const UShort_t *last = std::upper_bound(first, end, entrymax);
+   return last - first < entrymax - entrymin + 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge with the other block
 /// Returns the resulting number of entries in the block
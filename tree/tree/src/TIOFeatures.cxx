@@ -46,6 +46,13 @@ using namespace ROOT;
  *
  * The method `TTree::SetIOFeatures` creates a copy of the feature set; subsequent changes
  * to the `TIOFeatures` object do not propagate to the `TTree`.
+ *
+ * With `kGenerateOffsetMap`, the baskets of variable-size branches do not store the offset
+ * of each entry: for branches with a count leaf (e.g. `x[n]/F`), the offsets are generated
+ * from the count values when the basket is read; for other branches (e.g. `std::vector<float>`),
+ * the sizes of the entries are stored instead, as they compress much better than offsets.
+ * In both cases, the offsets of all the entries of a basket are available as soon as the
+ * basket is read, so any entry of the basket can be positioned in constant time.
  */
 
 
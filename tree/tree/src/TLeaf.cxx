@@ -196,7 +196,12 @@ Int_t *TLeaf::GenerateOffsetArrayBase(Int_t base, Int_t events) const
       return nullptr;
    }
 
-   Long64_t orig_entry = std::max(fBranch->GetReadEntry(), 0LL); // -1 indicates to start at the beginning
+   // The offsets are generated for the whole basket being read, which does not necessarily start at the entry being
+   // read (e.g. TEntryList or TTreeIndex lookups).
+   const Int_t readBasket = fBranch->GetReadBasket();
+   Long64_t orig_entry = (readBasket >= 0 && readBasket <= fBranch->GetWriteBasket())
+                            ? fBranch->GetBasketEntry()[readBasket]
+                            : std::max(fBranch->GetReadEntry(), 0LL); // -1 indicates to start at the beginning
    const std::vector<Int_t> *countValues = fLeafCount->GetLeafCountValues(orig_entry, events);
 
    if (!countValues || ((Int_t)countValues->size()) < events) {
@@ -367,7 +372,7 @@ const TLeaf::Counts_t *TLeaf::GetLeafCountValues(Long64_t start, Long64_t len)
      return nullptr;
 
    if (fLeafCountValues) {
-      if (fLeafCountValues->fStartEntry == start && len < (Long64_t)fLeafCountValues->fValues.size())
+      if (fLeafCountValues->fStartEntry == start && len <= (Long64_t)fLeafCountValues->fValues.size())
       {
          return &fLeafCountValues->fValues;
       }
@@ -8691,11 +8691,9 @@ Int_t TTree::SetCacheSizeAux(Bool_t autocache /* = kTRUE */, Long64_t cacheSize
       return 0;
    }
 
-#ifdef R__USE_IMT
    if(TTreeCacheUnzip::IsParallelUnzip() && file->GetCompressionLevel() > 0)
       pf = new TTreeCacheUnzip(this, cacheSize);
    else
-#endif
       pf = new TTreeCache(this, cacheSize);
 
    pf->SetAutoCreated(autocache);
@@ -9143,10 +9141,13 @@ void TTree::SetObject(const char* name, const char* title)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Enable or disable parallel unzipping of Tree buffers.
+///
+/// The baskets are unzipped in the implicit multi-threading pool if it is
+/// enabled, on helper threads otherwise, see TTreeCacheUnzip.
+/// RelSize is kept for backward compatibility and has no effect anymore.
 
 void TTree::SetParallelUnzip(Bool_t opt, Float_t RelSize)
 {
-#ifdef R__USE_IMT
    if (GetTree() == 0) {
       LoadTree(GetReadEntry());
       if (!GetTree())
@@ -9173,10 +9174,6 @@ void TTree::SetParallelUnzip(Bool_t opt, Float_t RelSize)
    } else {
       pf = new TTreeCache(this, cacheSize);
    }
-#else
-   (void)opt;
-   (void)RelSize;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
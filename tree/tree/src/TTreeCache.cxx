@@ -289,6 +289,7 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TList.h"
 #include "TBranch.h"
 #include "TBranchElement.h"
+#include "TEntryList.h"
 #include "TEventList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
@@ -300,6 +301,8 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
 #include <limits.h>
+#include <map>
+#include <utility>
 
 Int_t TTreeCache::fgLearnEntries = 100;
 
@@ -1305,6 +1308,24 @@ Bool_t TTreeCache::FillBuffer()
       }
    }
 
+   // Likewise, if the owner has a TEntryList set, read only the baskets of the
+   // current tree containing entries of its list, which uses local entry numbers.
+   TEntryList *entryList = elist ? nullptr : fTree->GetEntryList();
+   if (entryList && entryList->GetLists()) {
+      // The sub-list of the current tree, see TChain::SetEntryList and TEntryList::SetTree
+      TEntryList *current = entryList->GetCurrentList();
+      Bool_t isCurrent = current && (fTree->IsA() == TChain::Class()
+                                        ? current->GetTreeNumber() == static_cast<TChain *>(fTree)->GetTreeNumber()
+                                        : !strcmp(current->GetTreeName(), fTree->GetName()));
+      entryList = isCurrent ? current : nullptr;
+   } else if (entryList && fTree->IsA() == TChain::Class()) {
+      entryList = nullptr;
+   }
+   TTree *entryListTree = fTree->GetTree();
+   auto EntryListContainsRange = [entryList](Long64_t first, Long64_t last) {
+      return entryList->ContainsRange(first, last);
+   };
+
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
    if (fEnablePrefetching){ //prefetching mode
@@ -1359,7 +1380,8 @@ Bool_t TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, chainOffset, entryList, entryListTree, entry, clusterIterations,
+       resetBranchInfo, perfStats, &EntryListContainsRange,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1488,6 +1510,12 @@ Bool_t TTreeCache::FillBuffer()
                      continue;
                }
 
+               if (entryList && b->GetTree() == entryListTree) {
+                  Long64_t emax = (j < nb - 1) ? entries[j + 1] - 1 : b->GetEntries() - 1;
+                  if (!EntryListContainsRange(entries[j], emax))
+                     continue;
+               }
+
                if (b->fCacheInfo.HasBeenUsed(j) || b->fCacheInfo.IsInCache(j) || b->fCacheInfo.IsVetoed(j)) {
                   // We already cached and used this basket during this cluster range,
                   // let's not redo it
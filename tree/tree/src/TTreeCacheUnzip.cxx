@@ -16,6 +16,22 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+The baskets of the current cluster are unzipped by background tasks as soon as
+the cache is filled. In addition, the baskets of the next clusters (see
+SetReadAheadClusters()) are read ahead by the main thread when it enters a new
+cluster and handed to the background tasks, so that the I/O of the next cluster
+overlaps with the unzipping of the current one.
+
+The background tasks run in the implicit multi-threading pool if it is enabled,
+and on a set of helper threads shared by all the caches of the process otherwise
+(see SetUnzipNThreads()). The latter makes parallel unzipping available to
+single-thread event loops, e.g. the ones of TTreeReader and RDataFrame:
+~~~ {.cpp}
+TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+ROOT::RDataFrame df("tree", "file.root");
+~~~
+The time the main thread spent waiting for baskets being unzipped by other
+threads is returned by GetStallTime() and printed by Print().
 */
 
 #include "TTreeCacheUnzip.h"
@@ -30,10 +46,17 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "ROOT/RMakeUnique.hxx"
 
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
 
@@ -44,8 +67,172 @@ TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kD
 // Hence there is no good reason to limit it too much
 Double_t TTreeCacheUnzip::fgRelBuffSize = .5;
 
+UInt_t TTreeCacheUnzip::fgUnzipNThreads = 0;
+
 ClassImp(TTreeCacheUnzip);
 
+namespace ROOT {
+namespace Internal {
+
+class RUnzipHelperPool;
+
+////////////////////////////////////////////////////////////////////////////////
+/// The unzipping tasks of a TTreeCacheUnzip run by the helper threads when
+/// implicit multi-threading is disabled.
+
+class RUnzipWorkers {
+   friend class RUnzipHelperPool;
+
+   unsigned int fNRunning = 0; ///< Tasks of this cache running now, protected by the mutex of the pool
+
+public:
+   explicit RUnzipWorkers(UInt_t nThreads);
+   ~RUnzipWorkers() { Cancel(); }
+
+   void Run(const std::function<void(void)> &task);
+   /// Drop the tasks not started yet and wait for the running ones.
+   void Cancel();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// The helper threads shared by all the TTreeCacheUnzip of the process. There
+/// are as many as the most requested by a cache so far. The pool is never
+/// deleted: caches can be destroyed during the tear down of the process.
+
+class RUnzipHelperPool {
+   struct RTask {
+      RUnzipWorkers *fOwner;
+      std::function<void(void)> fFunc;
+   };
+
+   UInt_t fNThreads = 0;
+   std::deque<RTask> fQueue; ///< Tasks not started yet, of all the caches
+   std::mutex fMutex;
+   std::condition_variable fWorkCV; ///< Signals new tasks to the threads
+   std::condition_variable fIdleCV; ///< Signals that a cache has no task running anymore
+
+   void Work()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fWorkCV.wait(lock, [this] { return !fQueue.empty(); });
+         auto task = std::move(fQueue.front());
+         fQueue.pop_front();
+         ++task.fOwner->fNRunning;
+         lock.unlock();
+         task.fFunc();
+         lock.lock();
+         if (--task.fOwner->fNRunning == 0)
+            fIdleCV.notify_all();
+      }
+   }
+
+public:
+   static RUnzipHelperPool &Get()
+   {
+      static auto pool = new RUnzipHelperPool();
+      return *pool;
+   }
+
+   /// Start threads until there are at least `nThreads`.
+   void Reserve(UInt_t nThreads)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (; fNThreads < nThreads; ++fNThreads)
+         std::thread(&RUnzipHelperPool::Work, this).detach();
+   }
+
+   void Run(RUnzipWorkers &owner, const std::function<void(void)> &task)
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fQueue.push_back({&owner, task});
+      }
+      fWorkCV.notify_one();
+   }
+
+   void Cancel(RUnzipWorkers &owner)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      auto isOwned = [&owner](const RTask &t) { return t.fOwner == &owner; };
+      fQueue.erase(std::remove_if(fQueue.begin(), fQueue.end(), isOwned), fQueue.end());
+      fIdleCV.wait(lock, [&owner] { return owner.fNRunning == 0; });
+   }
+};
+
+RUnzipWorkers::RUnzipWorkers(UInt_t nThreads)
+{
+   RUnzipHelperPool::Get().Reserve(nThreads);
+}
+
+void RUnzipWorkers::Run(const std::function<void(void)> &task)
+{
+   RUnzipHelperPool::Get().Run(*this, task);
+}
+
+void RUnzipWorkers::Cancel()
+{
+   RUnzipHelperPool::Get().Cancel(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The baskets read ahead of the current cluster. They are read by the main
+/// thread and unzipped by whichever thread claims them first.
+
+struct RUnzipReadAhead {
+   struct RBasket {
+      std::shared_ptr<std::vector<char>> fBlock; ///< The compressed baskets read together with this one
+      std::size_t fOffset = 0;                   ///< Position of the compressed basket in fBlock
+      Int_t fCompressedLen = 0;                  ///< Length of the compressed basket
+      Long64_t fEntryEnd = 0;                    ///< First entry after the basket
+      std::unique_ptr<char[]> fBuffer;           ///< The unzipped basket
+      Int_t fLen = 0;                            ///< Length of fBuffer, 0 if unzipping failed
+      Byte_t fState = TTreeCacheUnzip::kUntouched;
+   };
+
+   std::mutex fMutex;
+   std::condition_variable fCV;                           ///< Signals newly unzipped baskets
+   std::map<Long64_t, std::shared_ptr<RBasket>> fBaskets; ///< Indexed by the position of the basket in the file
+   Long64_t fClusterStart = -1; ///< First entry of the cluster that was current when reading ahead
+   Long64_t fEntryTrigger = -1; ///< Entry from which the next cluster is read ahead
+   Long64_t fEntryNext = -1;    ///< First entry that was not read ahead yet
+   Bool_t fResubmit = kFALSE;   ///< Whether unzipping tasks were dropped and must be submitted again
+
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fBaskets.clear();
+      fClusterStart = -1;
+      fEntryTrigger = -1;
+      fEntryNext = -1;
+      fResubmit = kFALSE;
+   }
+
+   Bool_t TryUnzipping(RBasket &basket)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (basket.fState != TTreeCacheUnzip::kUntouched)
+         return kFALSE;
+      basket.fState = TTreeCacheUnzip::kProgress;
+      return kTRUE;
+   }
+
+   void SetUnzipped(RBasket &basket, char *buf, Int_t len)
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         basket.fBuffer.reset(buf);
+         basket.fLen = (buf && len > 0) ? len : 0;
+         basket.fBlock.reset();
+         basket.fState = TTreeCacheUnzip::kFinished;
+      }
+      fCV.notify_all();
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear all baskets' state arrays.
 
@@ -159,13 +346,16 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fReadAheadClusters(1),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNReadAhead(0),
+   fStallTime(0)
 {
    // Default Constructor.
    Init();
@@ -178,13 +368,16 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fReadAheadClusters(1),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNReadAhead(0),
+   fStallTime(0)
 {
    Init();
 }
@@ -198,6 +391,7 @@ void TTreeCacheUnzip::Init()
    fUnzipTaskGroup.reset();
 #endif
    fIOMutex = std::make_unique<TMutex>(kTRUE);
+   fReadAhead = std::make_unique<ROOT::Internal::RUnzipReadAhead>();
 
    fCompBuffer = new char[16384];
    fCompBufferSize = 16384;
@@ -233,6 +427,7 @@ void TTreeCacheUnzip::Init()
 
 TTreeCacheUnzip::~TTreeCacheUnzip()
 {
+   CancelTasks();
    ResetCache();
    fUnzipState.Clear(fNseekMax);
 }
@@ -307,6 +502,14 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
 
+   // The baskets read ahead are not needed in the cache buffer (sorted by position)
+   std::vector<Long64_t> readAheadBaskets;
+   {
+      std::lock_guard<std::mutex> lock(fReadAhead->fMutex);
+      for (auto &b : fReadAhead->fBaskets)
+         readAheadBaskets.emplace_back(b.first);
+   }
+
    //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
       TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
@@ -326,6 +529,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          Long64_t pos = b->GetBasketSeek(j);
          Int_t len = lbaskets[j];
          if (pos <= 0 || len <= 0) continue;
+         if (std::binary_search(readAheadBaskets.begin(), readAheadBaskets.end(), pos)) continue;
          //important: do not try to read fEntryNext, otherwise you jump to the next autoflush
          if (entries[j] >= fEntryNext) continue;
          if (entries[j] < entry && (j < nb - 1 && entries[j+1] <= entry)) continue;
@@ -374,6 +578,8 @@ Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 void TTreeCacheUnzip::SetEntryRange(Long64_t emin, Long64_t emax)
 {
    TTreeCache::SetEntryRange(emin, emax);
+   CancelTasks();
+   fReadAhead->Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +596,9 @@ void TTreeCacheUnzip::StopLearningPhase()
 
 void TTreeCacheUnzip::UpdateBranches(TTree *tree)
 {
+   // The baskets read ahead belong to the previous tree
+   CancelTasks();
+   fReadAhead->Clear();
    TTreeCache::UpdateBranches(tree);
 }
 
@@ -441,6 +650,71 @@ Int_t TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that returns the number of helper threads that unzip the
+/// baskets when implicit multi-threading is disabled.
+
+UInt_t TTreeCacheUnzip::GetUnzipNThreads()
+{
+   if (fgUnzipNThreads > 0)
+      return fgUnzipNThreads;
+   UInt_t nCores = std::thread::hardware_concurrency();
+   return nCores > 1 ? nCores - 1 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that sets the number of helper threads that unzip the
+/// baskets when implicit multi-threading is disabled. With 0, the default,
+/// one thread per core but one is used. The helper threads are shared by all
+/// the caches of the process and are never stopped: a larger number applies
+/// to the caches that did not start unzipping yet, a smaller one has no effect
+/// once the threads are started.
+///
+/// When implicit multi-threading is enabled, the baskets are unzipped in its
+/// thread pool instead.
+
+void TTreeCacheUnzip::SetUnzipNThreads(UInt_t nThreads)
+{
+   fgUnzipNThreads = nThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run a task in the background, in the implicit multi-threading pool if it
+/// is enabled, on the helper threads otherwise.
+
+void TTreeCacheUnzip::RunTask(const std::function<void(void)> &task)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      if (!fUnzipTaskGroup)
+         fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+      fUnzipTaskGroup->Run(task);
+      return;
+   }
+#endif
+   if (!fUnzipWorkers)
+      fUnzipWorkers = std::make_unique<ROOT::Internal::RUnzipWorkers>(GetUnzipNThreads());
+   fUnzipWorkers->Run(task);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Drop the background tasks that did not start yet and wait for the
+/// running ones. The baskets read ahead that were not unzipped yet are handed
+/// to new tasks by the next call to ReadAhead().
+
+void TTreeCacheUnzip::CancelTasks()
+{
+#ifdef R__USE_IMT
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
+#endif
+   if (fUnzipWorkers)
+      fUnzipWorkers->Cancel();
+   fReadAhead->fResubmit = kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
 // From now on we have the methods concerning the unzipping part of the cache //
@@ -568,20 +842,6 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 
    GetRecordHeader(locbuff, hlen, nbytes, objlen, keylen);
 
-   Int_t len = (objlen > nbytes - keylen) ? keylen + objlen : nbytes;
-   // If the single unzipped chunk is really too big, reset it to not processable
-   // I.e. mark it as done but set the pointer to 0
-   // This block will be unzipped synchronously in the main thread
-   // TODO: ROOT internally breaks zipped buffers into 16MB blocks, we can probably still unzip in parallel.
-   if (len > 4 * fUnzipBufferSize) {
-           if (gDebug > 0)
-                   Info("UnzipCache", "Block %d is too big, skipping.", index);
-
-           fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
-           return 0;
-   }
-
    // Unzip it into a new blk
    char *ptr = nullptr;
    Int_t loclen = UnzipBuffer(&ptr, locbuff);
@@ -603,56 +863,259 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    return 0;
 }
 
-#ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// We asynchronously map each group of baskets (> 100 kB in total) to a task,
+/// see RunTask(). The purpose of the background tasks is to avoid competing
+/// with the main thread.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
-               Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
-            }
+   auto unzipFunction = [this](const std::vector<Int_t> &indices) {
+      // If cache is invalidated and we should return immediately.
+      if (!fIsTransferred) return;
+
+      for (auto ii : indices) {
+         if(fUnzipState.TryUnzipping(ii)) {
+            Int_t res = UnzipCache(ii);
+            if(res)
+               if (gDebug > 0)
+                  Info("UnzipCache", "Unzipping failed or cache is in learning state");
          }
-         return nullptr;
-      };
+      }
+   };
 
+   Int_t accusz = 0;
+   std::vector<Int_t> indices;
+   if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
+   for (Int_t i = 0; i < fNseek; i++) {
+      while (accusz < fUnzipGroupSize) {
+         accusz += fSeekLen[i];
+         indices.push_back(i);
+         i++;
+         if (i >= fNseek) break;
+      }
+      if (i < fNseek) i--;
+      RunTask([unzipFunction, indices]() { unzipFunction(indices); });
+      indices.clear();
+      accusz = 0;
+   }
+
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the baskets of the clusters following the current one and hand them to
+/// background tasks for unzipping. This is done once per cluster, when the
+/// main thread enters it: the I/O of the next clusters then overlaps with the
+/// unzipping of the baskets of the current one, which were read ahead before.
+/// The baskets are kept until they are requested or their cluster is left
+/// behind, independently of the content of the cache buffer.
+
+void TTreeCacheUnzip::ReadAhead()
+{
+   using RBasket = ROOT::Internal::RUnzipReadAhead::RBasket;
+
+   if (fReadAheadClusters <= 0 || fNbranches <= 0 || !fFile)
+      return;
+
+   auto &readAhead = *fReadAhead;
+   auto unzipFunction = [this](const std::vector<std::shared_ptr<RBasket>> &baskets) {
+      for (auto &basket : baskets) {
+         if (!fReadAhead->TryUnzipping(*basket))
+            continue;
+         char *ptr = nullptr;
+         Int_t len = UnzipBuffer(&ptr, basket->fBlock->data() + basket->fOffset);
+         fReadAhead->SetUnzipped(*basket, ptr, len);
+      }
+   };
+   // Hand the baskets to tasks, by groups of at least fUnzipGroupSize bytes
+   auto submit = [&](const std::vector<std::shared_ptr<RBasket>> &baskets) {
+      std::vector<std::shared_ptr<RBasket>> group;
       Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
+      for (std::size_t i = 0; i < baskets.size(); ++i) {
+         group.emplace_back(baskets[i]);
+         accusz += baskets[i]->fCompressedLen;
+         if (accusz >= fUnzipGroupSize || i + 1 == baskets.size()) {
+            RunTask([unzipFunction, group]() { unzipFunction(group); });
+            group.clear();
+            accusz = 0;
          }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
       }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
    };
+   if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
+
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   Long64_t entry = tree->GetReadEntry();
+   if (entry < 0)
+      return;
 
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
-   fUnzipTaskGroup->Run(mapFunction);
+   if (entry < readAhead.fClusterStart) {
+      // Going backwards, the baskets read ahead are not needed for the time being
+      readAhead.Clear();
+   }
 
-   return 0;
+   if (readAhead.fResubmit) {
+      // Some tasks were dropped, the baskets they did not unzip need new ones
+      std::vector<std::shared_ptr<RBasket>> baskets;
+      {
+         std::lock_guard<std::mutex> lock(readAhead.fMutex);
+         for (auto &b : readAhead.fBaskets) {
+            if (b.second->fState == kUntouched)
+               baskets.emplace_back(b.second);
+         }
+      }
+      submit(baskets);
+      readAhead.fResubmit = kFALSE;
+   }
+
+   if (entry < readAhead.fEntryTrigger)
+      return;
+
+   Long64_t entryMax = (fEntryMax > 0) ? fEntryMax : tree->GetEntries();
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(entry);
+   Long64_t clusterStart = clusterIter();
+   Long64_t clusterEnd = clusterIter.GetNextEntry();
+   Long64_t start = std::max(readAhead.fEntryNext, clusterEnd);
+   Long64_t end = clusterEnd;
+   for (Int_t i = 0; i < fReadAheadClusters && end < entryMax; ++i) {
+      clusterIter();
+      end = clusterIter.GetNextEntry();
+   }
+   end = std::min(end, entryMax);
+
+   {
+      // Forget the baskets of the clusters left behind
+      std::lock_guard<std::mutex> lock(readAhead.fMutex);
+      for (auto it = readAhead.fBaskets.begin(); it != readAhead.fBaskets.end();) {
+         if (it->second->fEntryEnd <= clusterStart)
+            it = readAhead.fBaskets.erase(it);
+         else
+            ++it;
+      }
+   }
+   readAhead.fClusterStart = clusterStart;
+   readAhead.fEntryTrigger = clusterEnd;
+   if (start >= end)
+      return;
+   readAhead.fEntryNext = end;
+
+   // Collect the baskets starting in [start, end)
+   struct RBasketInfo {
+      Long64_t fPos;
+      Int_t fLen;
+      Long64_t fEntryEnd;
+   };
+   std::vector<RBasketInfo> infos;
+   for (Int_t i = 0; i < fNbranches; i++) {
+      TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
+      if (b->GetDirectory() == 0) continue;
+      if (b->GetDirectory()->GetFile() != fFile) continue;
+      Int_t nb = b->GetMaxBaskets();
+      Int_t *lbaskets   = b->GetBasketBytes();
+      Long64_t *entries = b->GetBasketEntry();
+      if (!lbaskets || !entries) continue;
+      for (Int_t j = 0; j < nb; j++) {
+         Long64_t pos = b->GetBasketSeek(j);
+         Int_t len = lbaskets[j];
+         if (pos <= 0 || len <= 0) continue;
+         if (entries[j] < start || entries[j] >= end) continue;
+         Long64_t entryEnd = (j < nb - 1 && entries[j+1] > entries[j]) ? entries[j+1] : entryMax;
+         infos.push_back({pos, len, entryEnd});
+      }
+   }
+   if (infos.empty())
+      return;
+   std::sort(infos.begin(), infos.end(),
+             [](const RBasketInfo &a, const RBasketInfo &b) { return a.fPos < b.fPos; });
+
+   std::vector<Long64_t> pos(infos.size());
+   std::vector<Int_t> lens(infos.size());
+   std::size_t total = 0;
+   for (std::size_t i = 0; i < infos.size(); ++i) {
+      pos[i] = infos[i].fPos;
+      lens[i] = infos[i].fLen;
+      total += infos[i].fLen;
+   }
+   auto block = std::make_shared<std::vector<char>>(total);
+   Bool_t failed;
+   {
+      R__LOCKGUARD(fIOMutex.get());
+      failed = fFile->ReadBuffers(block->data(), pos.data(), lens.data(), (Int_t)infos.size());
+   }
+   if (failed) {
+      // The baskets will be read and unzipped on demand
+      if (gDebug > 0)
+         Info("ReadAhead", "Reading the baskets of entries [%lld, %lld) failed", start, end);
+      return;
+   }
+
+   std::vector<std::shared_ptr<RBasket>> baskets;
+   {
+      std::lock_guard<std::mutex> lock(readAhead.fMutex);
+      std::size_t offset = 0;
+      for (auto &info : infos) {
+         auto basket = std::make_shared<RBasket>();
+         basket->fBlock = block;
+         basket->fOffset = offset;
+         basket->fCompressedLen = info.fLen;
+         basket->fEntryEnd = info.fEntryEnd;
+         offset += info.fLen;
+         if (readAhead.fBaskets.emplace(info.fPos, basket).second)
+            baskets.emplace_back(basket);
+      }
+   }
+   submit(baskets);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get a basket that was read ahead, see ReadAhead(), waiting for the task
+/// that unzips it if needed. If no task took care of it yet, the basket is
+/// unzipped by the calling thread.
+/// Returns the length of the unzipped buffer, or -1 if the basket was not read
+/// ahead or could not be unzipped. The arguments are the ones of GetUnzipBuffer.
+
+Int_t TTreeCacheUnzip::GetReadAheadBuffer(char **buf, Long64_t pos, Bool_t *free)
+{
+   auto &readAhead = *fReadAhead;
+   std::shared_ptr<ROOT::Internal::RUnzipReadAhead::RBasket> basket;
+   Bool_t unzip = kFALSE;
+   {
+      std::unique_lock<std::mutex> lock(readAhead.fMutex);
+      auto it = readAhead.fBaskets.find(pos);
+      if (it == readAhead.fBaskets.end())
+         return -1;
+      basket = it->second;
+      readAhead.fBaskets.erase(it);
+      if (basket->fState == kUntouched) {
+         basket->fState = kProgress;
+         unzip = kTRUE;
+      } else if (basket->fState == kProgress) {
+         auto start = std::chrono::steady_clock::now();
+         readAhead.fCV.wait(lock, [&basket] { return basket->fState == kFinished; });
+         fStallTime += std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count();
+         fNStalls++;
+      }
+   }
+
+   if (unzip) {
+      char *ptr = nullptr;
+      Int_t len = UnzipBuffer(&ptr, basket->fBlock->data() + basket->fOffset);
+      readAhead.SetUnzipped(*basket, ptr, len);
+   }
+
+   if (basket->fLen <= 0)
+      return -1;
+
+   if (!(*buf)) {
+      *buf = basket->fBuffer.release();
+      *free = kTRUE;
+   } else {
+      memcpy(*buf, basket->fBuffer.get(), basket->fLen);
+      *free = kFALSE;
+   }
+   fNReadAhead++;
+   return basket->fLen;
 }
-#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /// We try to read a buffer that has already been unzipped
@@ -682,6 +1145,12 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
    if (fParallel && !fIsLearning) {
 
+      ReadAhead();
+      res = GetReadAheadBuffer(buf, pos, free);
+      if (res > 0)
+         return res;
+      res = 0;
+
       if(fNseekMax < fNseek){
          if (gDebug > 0)
             Info("GetUnzipBuffer", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
@@ -696,6 +1165,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
          // The buffer is, at minimum, in the file cache. We must know its index in the requests list
          // In order to get its info
          Int_t seekidx = fSeekIndex[loc];
+         auto stallStart = std::chrono::steady_clock::now();
 
          do {
 
@@ -763,6 +1233,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
             }
 
             fNStalls++;
+            fStallTime += std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - stallStart).count();
             return fUnzipState.fUnzipLen[seekidx];
          } else {
             // This is a complete miss. We want to avoid the background tasks
@@ -790,23 +1261,18 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    res = 0;
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
       // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
-#endif
+      CancelTasks();
       {
          // Fill new baskets into cache.
          R__LOCKGUARD(fIOMutex.get());
 	      fFile->Seek(pos);
 	      res = fFile->ReadBuffer(fCompBuffer, len);
       } // end of lock scope
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled()) {
+      if (fParallel) {
          CreateTasks();
+         // Resubmit the baskets read ahead whose tasks were dropped above
+         ReadAhead();
       }
-#endif
    }
 
    if (res) res = -1;
@@ -946,10 +1412,12 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
 void  TTreeCacheUnzip::Print(Option_t* option) const {
 
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
-   printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
+   printf("Number of clusters read ahead: %d\n", fReadAheadClusters);
    printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
    printf("Number of hits: %d\n", fNFound);
+   printf("Number of hits in the clusters read ahead: %d\n", fNReadAhead);
    printf("Number of stalls: %d\n", fNStalls);
+   printf("Time blocked waiting for unzipping: %.3f s\n", fStallTime);
    printf("Number of misses: %d\n", fNMissed);
 
    TTreeCache::Print(option);
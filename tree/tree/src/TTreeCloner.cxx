@@ -37,6 +37,7 @@ Class implementing or helping  the various TTree cloning method
 #include "snprintf.h"
 
 #include <algorithm>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -345,6 +346,24 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (from->fCompressionDictSize > 0) {
+      // The copied baskets need the compression dictionary of the export branch: the import branch adopts it,
+      // unless it already has a different one.
+      if (to->fCompressionDictSize == 0) {
+         to->SetCompressionDictionary(from->fCompressionDict, from->fCompressionDictSize);
+      } else if (to->fCompressionDictSize != from->fCompressionDictSize ||
+                 memcmp(to->fCompressionDict, from->fCompressionDict, from->fCompressionDictSize) != 0) {
+         fWarningMsg.Form("The export branch and the import branch (%s) do not have the same compression dictionary.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -1,10 +1,15 @@
 #include "TFile.h"
+#include "TList.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <cstdlib>
+#include <memory>
+
 class TBranchTest : public ::testing::Test {
 protected:
    virtual void SetUp()
@@ -229,4 +234,92 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+
+TEST(TBranchCompression, ZSTDDictionary)
+{
+   const auto fileName = "TBranchZSTDDictionary.root";
+   const auto cloneFileName = "TBranchZSTDDictionary_clone.root";
+   const Int_t nEntries = 20000;
+   const auto settings = ROOT::RCompressionSetting::EAlgorithm::kZSTDDictionary * 100 + 5;
+   {
+      TFile file(fileName, "RECREATE", "", settings);
+      TTree tree("tree", "tree");
+      TRandom random(42);
+      Int_t i = 0;
+      Float_t x = 0;
+      // small baskets, for which the dictionary matters
+      tree.Branch("i", &i, 2000);
+      tree.Branch("x", &x, 2000);
+      for (Int_t e = 0; e < nEntries; ++e) {
+         i = random.Integer(100);
+         x = Int_t(random.Gaus(100, 7));
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   auto check = [&](const char *name) {
+      TFile file(name);
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(tree, nullptr);
+      Int_t dictSize = 0;
+      EXPECT_NE(tree->GetBranch("i")->GetCompressionDictionary(dictSize), nullptr);
+      EXPECT_GT(dictSize, 0);
+      TRandom random(42);
+      Int_t i = 0;
+      Float_t x = 0;
+      tree->SetBranchAddress("i", &i);
+      tree->SetBranchAddress("x", &x);
+      ASSERT_EQ(tree->GetEntries(), nEntries);
+      for (Int_t e = 0; e < nEntries; ++e) {
+         ASSERT_GT(tree->GetEntry(e), 0);
+         EXPECT_EQ(i, Int_t(random.Integer(100)));
+         EXPECT_EQ(x, Float_t(Int_t(random.Gaus(100, 7))));
+      }
+   };
+   check(fileName);
+
+   // fast cloning copies the compressed baskets, and the dictionary they need
+   {
+      TFile file(fileName);
+      TFile cloneFile(cloneFileName, "RECREATE");
+      auto clone = file.Get<TTree>("tree")->CloneTree(-1, "fast");
+      clone->Write();
+   }
+   check(cloneFileName);
+
+   gSystem->Unlink(fileName);
+   gSystem->Unlink(cloneFileName);
+}
+
+TEST(TBranchCompression, ZSTDWriteAtExit)
+{
+   // The files still open at exit are closed by an atexit handler, which compresses their streamer infos. exit()
+   // calls it after destroying the thread-local objects of the main thread, such as its ZSTD compression context.
+   const auto fileName = "TBranchZSTDWriteAtExit.root";
+   const Int_t nEntries = 1000;
+   auto writeAndExit = [&]() {
+      new TFile(fileName, "RECREATE", "", ROOT::RCompressionSetting::EAlgorithm::kZSTD * 100 + 5); // left open
+      auto tree = new TTree("tree", "tree");
+      Int_t i = 0;
+      tree->Branch("i", &i);
+      for (i = 0; i < nEntries; ++i)
+         tree->Fill();
+      tree->Write();
+      std::exit(0);
+   };
+   EXPECT_EXIT(writeAndExit(), ::testing::ExitedWithCode(0), "");
+
+   {
+      TFile file(fileName);
+      ASSERT_FALSE(file.IsZombie());
+      std::unique_ptr<TList> streamerInfos{file.GetStreamerInfoList()};
+      ASSERT_NE(streamerInfos, nullptr);
+      EXPECT_GT(streamerInfos->GetSize(), 0);
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(tree, nullptr);
+      EXPECT_EQ(tree->GetEntries(), nEntries);
+   }
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,41 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+// ContainsRange must find the entries whatever the storage of the blocks: bits, list of the entries that pass or list
+// of the entries that do not pass
+TEST(TEntryList, ContainsRange)
+{
+   auto inSparse = [](Long64_t e) { return e < 200000 && e % 1000 == 100; };
+   auto inDense = [](Long64_t e) { return e < 200000 && e % 1000 != 7; };
+   TEntryList sparse;
+   TEntryList dense;
+   for (Long64_t e = 0; e < 200000; ++e) {
+      if (inSparse(e))
+         sparse.Enter(e);
+      if (inDense(e))
+         dense.Enter(e);
+   }
+
+   const std::vector<std::pair<Long64_t, Long64_t>> ranges{
+      {0, 99},      {0, 100},       {100, 100},     {101, 1099}, {101, 1100},       {7, 7},          {1007, 1007},
+      {1006, 1008}, {63990, 64010}, {63999, 64000}, {0, 199999}, {199950, 250000}, {200000, 300000}};
+   auto check = [&ranges](TEntryList &list, bool (*contains)(Long64_t)) {
+      for (const auto &r : ranges) {
+         bool expected = false;
+         for (Long64_t e = r.first; e <= r.second && !expected; ++e)
+            expected = contains(e);
+         EXPECT_EQ(list.ContainsRange(r.first, r.second), expected) << r.first << " " << r.second;
+      }
+   };
+
+   check(sparse, inSparse);
+   check(dense, inDense);
+   sparse.OptimizeStorage();
+   dense.OptimizeStorage();
+   check(sparse, inSparse);
+   check(dense, inDense);
+}
@@ -1,4 +1,6 @@
+#include "TEntryList.h"
 #include "TFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TBasket.h"
@@ -10,6 +12,8 @@
 
 #include "ElementStruct.h"
 
+#include <vector>
+
 class TOffsetGeneration : public ::testing::Test {
 protected:
    static constexpr int fEventCount = 10000;
@@ -185,3 +189,118 @@ TEST_F(TOffsetGeneration, elementsTest)
 
    ASSERT_TRUE(br->GetTotalSize() < fEventCount * 10);
 }
+
+// Writes a tree with variable-size branches, one basket per 100 entries and a single cluster.
+static void WriteRandomAccessTree(const char *fileName, Int_t eventCount)
+{
+   TFile file(fileName, "RECREATE");
+   TTree tree("tree", "A test tree");
+   ROOT::TIOFeatures features;
+   features.Set(ROOT::Experimental::EIOFeatures::kGenerateOffsetMap);
+   tree.SetIOFeatures(features);
+   tree.SetAutoFlush(eventCount);
+   Int_t elem = 0;
+   Int_t sample[10];
+   std::vector<float> vec;
+   tree.Branch("elem", &elem, "elem/I", 1000);
+   tree.Branch("sample", &sample, "sample[elem]/I", 1000);
+   tree.Branch("vec", &vec, 1000);
+   for (Int_t ev = 0; ev < eventCount; ev++) {
+      elem = ev % 10;
+      vec.resize(ev % 7);
+      for (Int_t idx = 0; idx < elem; idx++)
+         sample[idx] = 10 * ev + idx;
+      for (std::size_t idx = 0; idx < vec.size(); idx++)
+         vec[idx] = ev + 0.5f * idx;
+      tree.Fill();
+   }
+   file.Write();
+}
+
+TEST(TOffsetGenerationRandomAccess, entriesInTheMiddleOfBaskets)
+{
+   const auto fileName = "TOffsetGenerationRandomAccess1.root";
+   const Int_t eventCount = 5000;
+   WriteRandomAccessTree(fileName, eventCount);
+
+   {
+      TFile file(fileName);
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(tree, nullptr);
+      ASSERT_GT(tree->GetBranch("sample")->GetWriteBasket(), 1);
+      Int_t elem = 0;
+      Int_t sample[10];
+      std::vector<float> *vec = nullptr;
+      tree->SetBranchAddress("elem", &elem);
+      tree->SetBranchAddress("sample", &sample);
+      tree->SetBranchAddress("vec", &vec);
+
+      // Start in the middle of the baskets, go backwards and jump around
+      TRandom random(42);
+      std::vector<Long64_t> entries{eventCount / 2 + 7, 3, 4999, 2};
+      for (Int_t idx = 0; idx < 200; idx++)
+         entries.push_back(random.Integer(eventCount));
+      for (auto entry : entries) {
+         ASSERT_GT(tree->GetEntry(entry), 0);
+         ASSERT_EQ(elem, entry % 10);
+         for (Int_t idx = 0; idx < elem; idx++)
+            ASSERT_EQ(sample[idx], 10 * entry + idx);
+         ASSERT_EQ(vec->size(), std::size_t(entry % 7));
+         for (std::size_t idx = 0; idx < vec->size(); idx++)
+            ASSERT_FLOAT_EQ((*vec)[idx], entry + 0.5f * idx);
+      }
+      tree->ResetBranchAddresses();
+   }
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TOffsetGenerationRandomAccess, treeCacheWithEntryList)
+{
+   const auto fileName = "TOffsetGenerationRandomAccess2.root";
+   const Int_t eventCount = 20000;
+   WriteRandomAccessTree(fileName, eventCount);
+
+   // Read the same sparse selection, with and without the TEntryList known to the TTreeCache
+   auto readSelection = [&](bool useEntryList) {
+      TFile file(fileName);
+      auto tree = file.Get<TTree>("tree");
+      EXPECT_NE(tree, nullptr);
+      TEntryList list("list", "list", tree);
+      for (Long64_t entry : {10, 11, 99, 12345, 19999})
+         list.Enter(entry);
+      if (useEntryList)
+         tree->SetEntryList(&list);
+      tree->SetCacheSize(64 * 1024 * 1024);
+      tree->AddBranchToCache("*", kTRUE);
+      tree->StopCacheLearningPhase();
+
+      Int_t elem = 0;
+      Int_t sample[10];
+      std::vector<float> *vec = nullptr;
+      tree->SetBranchAddress("elem", &elem);
+      tree->SetBranchAddress("sample", &sample);
+      tree->SetBranchAddress("vec", &vec);
+      const auto bytesBefore = file.GetBytesRead();
+      for (Long64_t idx = 0; idx < list.GetN(); idx++) {
+         const auto entry = list.GetEntry(idx);
+         EXPECT_GT(tree->GetEntry(entry), 0);
+         EXPECT_EQ(elem, entry % 10);
+         if (elem) {
+            EXPECT_EQ(sample[elem - 1], 10 * entry + elem - 1);
+         }
+         EXPECT_EQ(vec->size(), std::size_t(entry % 7));
+      }
+      const auto bytesRead = file.GetBytesRead() - bytesBefore;
+      tree->ResetBranchAddresses();
+      tree->SetEntryList(nullptr);
+      return bytesRead;
+   };
+
+   const auto bytesAll = readSelection(false);
+   const auto bytesSelected = readSelection(true);
+   // Only the baskets holding the selected entries are read: a handful out of more than a hundred per branch
+   EXPECT_LT(10 * bytesSelected, bytesAll);
+
+   gSystem->Unlink(fileName);
+}
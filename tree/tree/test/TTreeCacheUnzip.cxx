@@ -0,0 +1,144 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCacheUnzip.h"
+#include "TTreeReader.h"
+#include "TTreeReaderValue.h"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+constexpr const char *kFileName = "TTreeCacheUnzipTest.root";
+constexpr Long64_t kNEntries = 20000;
+
+class TTreeCacheUnzipTest : public ::testing::Test {
+protected:
+   TTreeCacheUnzip::EParUnzipMode fOldMode = TTreeCacheUnzip::kDisable;
+
+   virtual void SetUp()
+   {
+      {
+         TFile file(kFileName, "RECREATE");
+         TTree tree("tree", "A test tree");
+         tree.SetAutoFlush(1000);
+         Int_t x = 0;
+         Double_t y = 0;
+         tree.Branch("x", &x);
+         tree.Branch("y", &y);
+         for (Long64_t i = 0; i < kNEntries; ++i) {
+            x = i;
+            y = 0.5 * i;
+            tree.Fill();
+         }
+         file.Write();
+      }
+
+      fOldMode = TTreeCacheUnzip::GetParallelUnzip();
+      TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+      TTreeCacheUnzip::SetUnzipNThreads(2);
+   }
+
+   virtual void TearDown()
+   {
+      TTreeCacheUnzip::SetParallelUnzip(fOldMode);
+      TTreeCacheUnzip::SetUnzipNThreads(0);
+      gSystem->Unlink(kFileName);
+   }
+};
+
+TEST_F(TTreeCacheUnzipTest, ReadAheadWithTTreeReader)
+{
+   TFile file(kFileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+
+   TTreeReader reader(tree);
+   TTreeReaderValue<Int_t> x(reader, "x");
+   TTreeReaderValue<Double_t> y(reader, "y");
+   Long64_t n = 0;
+   while (reader.Next()) {
+      ASSERT_EQ(*x, n);
+      ASSERT_DOUBLE_EQ(*y, 0.5 * n);
+      ++n;
+   }
+   EXPECT_EQ(n, kNEntries);
+
+   auto cache = dynamic_cast<TTreeCacheUnzip *>(file.GetCacheRead(tree));
+   ASSERT_NE(cache, nullptr);
+   EXPECT_EQ(cache->GetReadAheadClusters(), 1);
+   // All the clusters but the first two are read ahead: one basket per branch and cluster
+   EXPECT_GE(cache->GetNReadAhead(), 2 * (kNEntries / 1000 - 2));
+   EXPECT_GE(cache->GetStallTime(), 0.);
+}
+
+TEST_F(TTreeCacheUnzipTest, ReadAheadJumps)
+{
+   TFile file(kFileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+
+   Int_t x = -1;
+   Double_t y = -1;
+   tree->SetBranchAddress("x", &x);
+   tree->SetBranchAddress("y", &y);
+
+   // Go forward, then back to the beginning, then skip a few clusters
+   std::vector<std::pair<Long64_t, Long64_t>> ranges{{0, 5500}, {1000, 3000}, {12000, kNEntries}};
+   for (auto &range : ranges) {
+      for (Long64_t i = range.first; i < range.second; ++i) {
+         tree->GetEntry(i);
+         ASSERT_EQ(x, i);
+         ASSERT_DOUBLE_EQ(y, 0.5 * i);
+      }
+   }
+
+   auto cache = dynamic_cast<TTreeCacheUnzip *>(file.GetCacheRead(tree));
+   ASSERT_NE(cache, nullptr);
+   EXPECT_GT(cache->GetNReadAhead(), 0);
+}
+
+TEST_F(TTreeCacheUnzipTest, NoReadAhead)
+{
+   TFile file(kFileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+
+   Int_t x = -1;
+   tree->SetBranchAddress("x", &x);
+   tree->GetEntry(0);
+   auto cache = dynamic_cast<TTreeCacheUnzip *>(file.GetCacheRead(tree));
+   ASSERT_NE(cache, nullptr);
+   cache->SetReadAheadClusters(0);
+
+   for (Long64_t i = 0; i < kNEntries; ++i) {
+      tree->GetEntry(i);
+      ASSERT_EQ(x, i);
+   }
+   EXPECT_EQ(cache->GetNReadAhead(), 0);
+}
+
+// The caches of two files share the helper threads
+TEST_F(TTreeCacheUnzipTest, TwoCaches)
+{
+   TFile file1(kFileName);
+   TFile file2(kFileName);
+   auto tree1 = file1.Get<TTree>("tree");
+   auto tree2 = file2.Get<TTree>("tree");
+   ASSERT_NE(tree1, nullptr);
+   ASSERT_NE(tree2, nullptr);
+
+   Int_t x1 = -1;
+   Int_t x2 = -1;
+   tree1->SetBranchAddress("x", &x1);
+   tree2->SetBranchAddress("x", &x2);
+   for (Long64_t i = 0; i < kNEntries; ++i) {
+      tree1->GetEntry(i);
+      tree2->GetEntry(kNEntries - 1 - i);
+      ASSERT_EQ(x1, i);
+      ASSERT_EQ(x2, kNEntries - 1 - i);
+   }
+   EXPECT_NE(dynamic_cast<TTreeCacheUnzip *>(file1.GetCacheRead(tree1)), nullptr);
+   EXPECT_NE(dynamic_cast<TTreeCacheUnzip *>(file2.GetCacheRead(tree2)), nullptr);
+}
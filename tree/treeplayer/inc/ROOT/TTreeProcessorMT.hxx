@@ -72,6 +72,20 @@ public:
 } // End of namespace Internal
 
 class TTreeProcessorMT {
+public:
+   /// Information about a task run by Process(), see GetTaskInfos()
+   struct RTaskInfo {
+      std::size_t fFileIdx; ///< Index of the processed file in the list of input files
+      /// First entry processed, as passed to TTreeReader::SetEntriesRange: local to the file if there are neither
+      /// friends nor an entry list, global to the chain of input files otherwise, and an entry list index if there is
+      /// an entry list
+      Long64_t fStart;
+      Long64_t fEnd;        ///< One past the last entry processed, in the same numbering as fStart
+      unsigned int fWorker; ///< Index of the worker that ran the task
+      bool fStolen;         ///< Whether the worker took the task from a file it was not processing
+      double fTime;         ///< Wall time spent running the task, including the TTreeReader setup, in seconds
+   };
+
 private:
    const std::vector<std::string> fFileNames; ///< Names of the files
    const std::vector<std::string> fTreeNames; ///< TTree names (always same size and ordering as fFileNames)
@@ -84,6 +98,9 @@ private:
    // Must be declared after fPool, for IMT to be initialized first!
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView{TNumSlots{ROOT::GetThreadPoolSize()}};
 
+   /// Tasks run by the last call to Process, grouped by worker
+   std::vector<RTaskInfo> fTaskInfos;
+
    std::vector<std::string> FindTreeNames();
    static unsigned int fgMaxTasksPerFilePerWorker;
    static unsigned int fgTasksPerWorkerHint;
@@ -96,6 +113,8 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
 
    void Process(std::function<void(TTreeReader &)> func);
+   /// Return the tasks run by the last call to Process, e.g. to diagnose load imbalance.
+   const std::vector<RTaskInfo> &GetTaskInfos() const { return fTaskInfos; }
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
@@ -19,14 +19,27 @@ passes a function whose only parameter is a TTreeReader. The function iterates
 on a subrange of entries by using that TTreeReader.
 
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
-each corresponding to a cluster in the TTree. This is possible thanks to the use
+each corresponding to one or more clusters in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+Subranges are scheduled dynamically: each worker processes the subranges of one file at a time, so that it can keep
+reusing the same TFile and TTree objects, and opens the next file nobody started processing yet when its file is
+done. When all files are started, idle workers steal subranges from the file with the most work left, and the last
+subranges are split in halves so that workers do not stay idle while others finish large subranges. The timing of
+each task of the last call to Process is available through GetTaskInfos().
 */
 
 #include "TROOT.h"
+#include "ROOT/TSeq.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+
 using namespace ROOT;
 
 namespace {
@@ -129,7 +142,7 @@ using ClustersAndEntries = std::pair<std::vector<std::vector<EntryCluster>>, std
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile)
+                                       const std::vector<std::string> &fileNames)
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
@@ -171,6 +184,19 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       entriesPerFile.emplace_back(entries);
    }
 
+   return std::make_pair(std::move(clustersPerFile), std::move(entriesPerFile));
+}
+
+/// A range of consecutive clusters of a file: the indices [first, last) in the clusters of the file
+struct ClusterRange {
+   std::size_t first;
+   std::size_t last;
+};
+
+////////////////////////////////////////////////////////////////////////
+/// Group the clusters of a file in at most maxTasksPerFile ranges.
+static std::deque<ClusterRange> MakeClusterRanges(std::size_t nClusters, unsigned int maxTasksPerFile)
+{
    // Here we "fuse" clusters together if the number of clusters is too big with respect to
    // the number of slots, otherwise we can incur in an overhead which is big enough
    // to make parallelisation detrimental to performance.
@@ -185,40 +211,157 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
    // The criterion according to which we fuse clusters together is to have around
    // TTreeProcessorMT::GetTasksPerWorkerHint() clusters per slot.
    // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers / nFiles).
+   std::deque<ClusterRange> ranges;
+   const auto nFolds = nClusters / maxTasksPerFile;
+   // If the number of clusters is less than maxTasksPerFile
+   // we take the clusters as they are
+   if (nFolds == 0) {
+      for (std::size_t i = 0; i < nClusters; ++i)
+         ranges.emplace_back(ClusterRange{i, i + 1});
+      return ranges;
+   }
+   // Otherwise, we have to merge clusters, distributing the reminder evenly
+   // onto the first clusters
+   auto nReminderClusters = nClusters % maxTasksPerFile;
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      const auto first = i;
+      // We lump together at least nFolds clusters, therefore
+      // we need to jump ahead of nFolds-1.
+      i += (nFolds - 1);
+      // We now add a cluster if we have some reminder left
+      if (nReminderClusters > 0) {
+         i += 1U;
+         nReminderClusters--;
+      }
+      ranges.emplace_back(ClusterRange{first, i + 1});
+   }
+   return ranges;
+}
+
+/// Hands out ranges of clusters to the workers of TTreeProcessorMT::Process.
+///
+/// A worker takes ranges from the front of the file it is processing as long as there are any, then opens the next
+/// file that nobody opened yet, and when all files are opened steals ranges from the back of the file with the most
+/// ranges left. When fewer ranges than workers are left, ranges of several clusters are split in halves, so that the
+/// end of the processing does not tail off with few workers busy with large ranges.
+class ClusterScheduler {
+public:
+   /// A task: the entries to process, in the numbering passed to TTreeReader::SetEntriesRange
+   struct Task {
+      std::size_t fileIdx;
+      EntryCluster entries;
+      bool stolen;
+   };
+   /// Return the clusters of the file with the given index. Called at most once per file, without holding the lock.
+   using OpenFn_t = std::function<std::vector<EntryCluster>(std::size_t)>;
+   static constexpr std::size_t kNoFile = std::numeric_limits<std::size_t>::max();
 
-   std::vector<std::vector<EntryCluster>> eventRangesPerFile(clustersPerFile.size());
-   auto clustersPerFileIt = clustersPerFile.begin();
-   auto eventRangesPerFileIt = eventRangesPerFile.begin();
-   for (; clustersPerFileIt != clustersPerFile.end(); clustersPerFileIt++, eventRangesPerFileIt++) {
-      const auto clustersInThisFileSize = clustersPerFileIt->size();
-      const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
-      // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
-      if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
-         continue;
+private:
+   struct FileWork {
+      std::vector<EntryCluster> clusters;
+      std::deque<ClusterRange> ranges; ///< Ranges not taken yet
+   };
+
+   std::vector<FileWork> fFiles;
+   const unsigned int fNWorkers;
+   const unsigned int fMaxTasksPerFile;
+   OpenFn_t fOpenFile;
+   std::size_t fNextFile = 0; ///< Index of the next file to open
+   std::size_t fNOpening = 0; ///< Number of files being opened by workers
+   std::size_t fNQueued = 0;  ///< Number of ranges not taken yet, over all files
+   bool fAborted = false;
+   std::mutex fMutex;
+   std::condition_variable fFileOpened;
+
+   Task Take(std::size_t fileIdx, bool stolen)
+   {
+      auto &file = fFiles[fileIdx];
+      // owners take from the front, thieves from the back, so that they do not compete for the same clusters
+      auto range = stolen ? file.ranges.back() : file.ranges.front();
+      stolen ? file.ranges.pop_back() : file.ranges.pop_front();
+      --fNQueued;
+      const bool allOpened = fNextFile == fFiles.size() && fNOpening == 0;
+      if (allOpened && fNQueued + 1 < fNWorkers && range.last - range.first > 1) {
+         const auto mid = range.first + (range.last - range.first) / 2;
+         if (stolen) {
+            file.ranges.emplace_back(ClusterRange{range.first, mid});
+            range.first = mid;
+         } else {
+            file.ranges.emplace_front(ClusterRange{mid, range.last});
+            range.last = mid;
+         }
+         ++fNQueued;
       }
-      // Otherwise, we have to merge clusters, distributing the reminder evenly
-      // onto the first clusters
-      auto nReminderClusters = clustersInThisFileSize % maxTasksPerFile;
-      const auto &clustersInThisFile = *clustersPerFileIt;
-      for (auto i = 0ULL; i < clustersInThisFileSize; ++i) {
-         const auto start = clustersInThisFile[i].start;
-         // We lump together at least nFolds clusters, therefore
-         // we need to jump ahead of nFolds-1.
-         i += (nFolds - 1);
-         // We now add a cluster if we have some reminder left
-         if (nReminderClusters > 0) {
-            i += 1U;
-            nReminderClusters--;
+      return Task{fileIdx, EntryCluster{file.clusters[range.first].start, file.clusters[range.last - 1].end}, stolen};
+   }
+
+public:
+   ClusterScheduler(std::size_t nFiles, unsigned int nWorkers, unsigned int maxTasksPerFile, OpenFn_t openFile)
+      : fFiles(nFiles), fNWorkers(nWorkers), fMaxTasksPerFile(maxTasksPerFile), fOpenFile(std::move(openFile))
+   {
+   }
+
+   /// Get the next task for a worker currently processing the file with index `currentFile`, which is updated.
+   /// Return false if there is nothing left to process.
+   bool Next(std::size_t &currentFile, Task &task)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (!fAborted) {
+         if (currentFile != kNoFile && !fFiles[currentFile].ranges.empty()) {
+            task = Take(currentFile, false);
+            return true;
+         }
+
+         if (fNextFile < fFiles.size()) {
+            const auto fileIdx = fNextFile++;
+            ++fNOpening;
+            lock.unlock();
+            std::vector<EntryCluster> clusters;
+            try {
+               clusters = fOpenFile(fileIdx);
+            } catch (...) {
+               Abort();
+               throw;
+            }
+            lock.lock();
+            --fNOpening;
+            auto &file = fFiles[fileIdx];
+            file.clusters = std::move(clusters);
+            file.ranges = MakeClusterRanges(file.clusters.size(), fMaxTasksPerFile);
+            fNQueued += file.ranges.size();
+            currentFile = fileIdx;
+            fFileOpened.notify_all();
+            continue;
+         }
+
+         std::size_t victim = kNoFile;
+         for (auto i = 0u; i < fFiles.size(); ++i) {
+            const auto nLeft = fFiles[i].ranges.size();
+            if (nLeft > 0 && (victim == kNoFile || nLeft > fFiles[victim].ranges.size()))
+               victim = i;
          }
-         const auto end = clustersInThisFile[i].end;
-         eventRangesPerFileIt->emplace_back(EntryCluster({start, end}));
+         if (victim != kNoFile) {
+            currentFile = victim;
+            task = Take(victim, true);
+            return true;
+         }
+
+         // nothing to take now, but the files being opened might still bring work
+         if (fNOpening == 0)
+            return false;
+         fFileOpened.wait(lock);
       }
+      return false;
    }
 
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
-}
+   /// Stop handing out tasks, e.g. because a worker failed
+   void Abort()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fAborted = true;
+      fFileOpened.notify_all();
+   }
+};
 
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector containing the number of entries of each file of each friend TChain
@@ -498,7 +641,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
    ClustersAndEntries clusterAndEntries{};
    if (shouldRetrieveAllClusters) {
-      clusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile);
+      clusterAndEntries = MakeClusters(fTreeNames, fFileNames);
       if (hasEntryList)
          clusterAndEntries.first = ConvertToElistClusters(std::move(clusterAndEntries.first), fEntryList, fTreeNames,
                                                           fFileNames, clusterAndEntries.second);
@@ -510,37 +653,55 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // Retrieve number of entries for each file for each friend tree
    const auto friendEntries = hasFriends ? GetFriendEntries(fFriendInfo) : std::vector<std::vector<Long64_t>>{};
 
-   // Parent task, spawns tasks that process each of the entry clusters for each input file
-   // TODO: for readability we should have two versions of this lambda, for shouldRetrieveAllClusters == true/false
-   auto processFile = [&](std::size_t fileIdx) {
-      // theseFiles contains either all files or just the single file to process
-      const auto &theseFiles = shouldRetrieveAllClusters ? fFileNames : std::vector<std::string>({fFileNames[fileIdx]});
-      // either all tree names or just the single tree to process
-      const auto &theseTrees = shouldRetrieveAllClusters ? fTreeNames : std::vector<std::string>({fTreeNames[fileIdx]});
-      // Evaluate clusters (with local entry numbers) and number of entries for this file, if needed
-      const auto theseClustersAndEntries =
-         shouldRetrieveAllClusters ? ClustersAndEntries{} : MakeClusters(theseTrees, theseFiles, maxTasksPerFile);
-
-      // All clusters for the file to process, either with global or local entry numbers
-      const auto &thisFileClusters = shouldRetrieveAllClusters ? clusters[fileIdx] : theseClustersAndEntries.first[0];
-
-      // Either all number of entries or just the ones for this file
-      const auto &theseEntries =
-         shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({theseClustersAndEntries.second[0]});
-
-      auto processCluster = [&](const EntryCluster &c) {
-         auto r = fTreeView->GetTreeReader(c.start, c.end, theseTrees, theseFiles, fFriendInfo, fEntryList,
-                                           theseEntries, friendEntries);
-         func(*r);
-      };
-
-      fPool.Foreach(processCluster, thisFileClusters);
+   // Number of entries of each file, filled when the scheduler opens the file if clusters are retrieved per file
+   std::vector<Long64_t> fileEntries(fFileNames.size());
+   auto openFile = [&](std::size_t fileIdx) {
+      if (shouldRetrieveAllClusters)
+         return clusters[fileIdx];
+      // Evaluate clusters (with local entry numbers) and number of entries for this file
+      auto theseClustersAndEntries = MakeClusters({fTreeNames[fileIdx]}, {fFileNames[fileIdx]});
+      fileEntries[fileIdx] = theseClustersAndEntries.second[0];
+      return std::move(theseClustersAndEntries.first[0]);
    };
 
-   std::vector<std::size_t> fileIdxs(fFileNames.size());
-   std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+   const auto nWorkers = fPool.GetPoolSize();
+   ClusterScheduler scheduler(fFileNames.size(), nWorkers, maxTasksPerFile, openFile);
+   std::vector<std::vector<RTaskInfo>> taskInfos(nWorkers);
+
+   // One long-lived task per worker, processing the entry ranges handed out by the scheduler
+   auto work = [&](unsigned int worker) {
+      try {
+         auto currentFile = ClusterScheduler::kNoFile;
+         ClusterScheduler::Task task;
+         while (scheduler.Next(currentFile, task)) {
+            // theseFiles contains either all files or just the single file to process
+            const auto &theseFiles =
+               shouldRetrieveAllClusters ? fFileNames : std::vector<std::string>({fFileNames[task.fileIdx]});
+            // either all tree names or just the single tree to process
+            const auto &theseTrees =
+               shouldRetrieveAllClusters ? fTreeNames : std::vector<std::string>({fTreeNames[task.fileIdx]});
+            // Either all number of entries or just the ones for this file
+            const auto &theseEntries =
+               shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({fileEntries[task.fileIdx]});
+
+            const auto start = std::chrono::steady_clock::now();
+            auto r = fTreeView->GetTreeReader(task.entries.start, task.entries.end, theseTrees, theseFiles,
+                                              fFriendInfo, fEntryList, theseEntries, friendEntries);
+            func(*r);
+            const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            taskInfos[worker].emplace_back(
+               RTaskInfo{task.fileIdx, task.entries.start, task.entries.end, worker, task.stolen, time.count()});
+         }
+      } catch (...) {
+         scheduler.Abort();
+         throw;
+      }
+   };
 
-   fPool.Foreach(processFile, fileIdxs);
+   fTaskInfos.clear();
+   fPool.Foreach(work, ROOT::TSeqU(nWorkers));
+   for (auto &infos : taskInfos)
+      fTaskInfos.insert(fTaskInfos.end(), infos.begin(), infos.end());
 }
 
 ////////////////////////////////////////////////////////////////////////